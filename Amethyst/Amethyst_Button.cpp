@@ -7,6 +7,7 @@
 
 namespace OpenGUI {
 	namespace Amethyst {
+		static const EventID Event_Activate( "Activate" );
 		//############################################################################
 		SimpleProperty_String( ButtonProperty_Text, "Text", Button, getText, setText );
 		SimpleProperty_Font( ButtonProperty_Font, "Font", Button, getFont, setFont );
@@ -38,6 +39,7 @@ namespace OpenGUI {
 			~Button_ObjectAccessorList() {}
 		}
 		gButton_ObjectAccessorList;
+		ClassEventList gButton_ClassEventList;
 		//############################################################################
 		//############################################################################
 		Widget* Button::createButtonFactory() {
@@ -52,8 +54,12 @@ namespace OpenGUI {
 			if ( gButton_ObjectAccessorList.getParent() == NULL )
 				gButton_ObjectAccessorList.setParent( Control::getAccessors() );
 
-			getEvents().createEvent( "Activate" );
-			getEvents()["Activate"].add( new EventDelegate( this, &Button::onActivate ) );
+			//Set up events and default bindings
+			if ( gButton_ClassEventList.empty() ) {
+				gButton_ClassEventList.setParent( getEvents().getClassEvents() );
+				gButton_ClassEventList.addEvent( Event_Activate, &Button::onActivate );
+			}
+			getEvents().setClassEvents( &gButton_ClassEventList );
 		}
 		//############################################################################
 		Button::~Button() {
@@ -153,7 +159,7 @@ namespace OpenGUI {
 		//############################################################################
 		void Button::eventActivate() {
 			EventArgs args;
-			getEvents().sendEvent( "Activate", args );
+			getEvents().sendEvent( Event_Activate, args );
 		}
 		//############################################################################
 		void Button::onActivate( Object* sender, EventArgs& evtArgs ) {
@@ -7,6 +7,9 @@
 
 namespace OpenGUI {
 	namespace Amethyst {
+		static const EventID Event_Activate( "Activate" );
+		static const EventID Event_ToggledOn( "ToggledOn" );
+		static const EventID Event_ToggledOff( "ToggledOff" );
 		//############################################################################
 		SimpleProperty_Face( CheckBoxProperty_FaceNormal, "Face_Normal", CheckBox, getFaceNormal, setFaceNormal );
 		SimpleProperty_Face( CheckBoxProperty_FaceOver, "Face_Over", CheckBox, getFaceOver, setFaceOver );
@@ -34,6 +37,7 @@ namespace OpenGUI {
 			~CheckBox_ObjectAccessorList() {}
 		}
 		gCheckBox_ObjectAccessorList;
+		ClassEventList gCheckBox_ClassEventList;
 		//############################################################################
 		//############################################################################
 		Widget* CheckBox::createCheckBoxFactory() {
@@ -49,12 +53,14 @@ namespace OpenGUI {
 				gCheckBox_ObjectAccessorList.setParent( Control::getAccessors() );
 			mSelected = false;
 
-			getEvents().createEvent( "Activate" );
-			getEvents()["Activate"].add( new EventDelegate( this, &CheckBox::onActivate ) );
-			getEvents().createEvent( "ToggledOn" );
-			getEvents().createEvent( "ToggledOff" );
-			getEvents()["ToggledOn"].add( new EventDelegate( this, &CheckBox::onToggledOn ) );
-			getEvents()["ToggledOff"].add( new EventDelegate( this, &CheckBox::onToggledOff ) );
+			//Set up events and default bindings
+			if ( gCheckBox_ClassEventList.empty() ) {
+				gCheckBox_ClassEventList.setParent( getEvents().getClassEvents() );
+				gCheckBox_ClassEventList.addEvent( Event_Activate, &CheckBox::onActivate );
+				gCheckBox_ClassEventList.addEvent( Event_ToggledOn, &CheckBox::onToggledOn );
+				gCheckBox_ClassEventList.addEvent( Event_ToggledOff, &CheckBox::onToggledOff );
+			}
+			getEvents().setClassEvents( &gCheckBox_ClassEventList );
 		}
 		//############################################################################
 		CheckBox::~CheckBox() {
@@ -140,17 +146,17 @@ namespace OpenGUI {
 		//############################################################################
 		void CheckBox::eventActivate() {
 			EventArgs args;
-			getEvents().sendEvent( "Activate", args );
+			getEvents().sendEvent( Event_Activate, args );
 		}
 		//############################################################################
 		void CheckBox::eventToggledOn() {
 			EventArgs args;
-			getEvents().sendEvent( "ToggledOn", args );
+			getEvents().sendEvent( Event_ToggledOn, args );
 		}
 		//############################################################################
 		void CheckBox::eventToggledOff() {
 			EventArgs args;
-			getEvents().sendEvent( "ToggledOff", args );
+			getEvents().sendEvent( Event_ToggledOff, args );
 		}
 		//############################################################################
 		void CheckBox::onActivate( Object* sender, EventArgs& evtArgs ) {
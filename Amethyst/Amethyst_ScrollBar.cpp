@@ -7,6 +7,7 @@
 
 namespace OpenGUI {
 	namespace Amethyst {
+		static const EventID Event_ValueChanged( "ValueChanged" );
 		//############################################################################
 		SimpleProperty_Float( ScrollBarP_Value, "Value", ScrollBar, getValue, setValue );
 		SimpleProperty_Float( ScrollBarP_Maximum, "Maximum", ScrollBar, getMaximum, setMaximum );
@@ -28,6 +29,7 @@ namespace OpenGUI {
 			~Scroll_ObjectAccessorList() {}
 		}
 		gScrollBar_ObjectAccessorList;
+		ClassEventList gScrollBar_ClassEventList;
 		//############################################################################
 		ObjectAccessorList* ScrollBar::getAccessors() {
 			return &gScrollBar_ObjectAccessorList;
@@ -47,8 +49,12 @@ namespace OpenGUI {
 			mValue = 0.0f;
 			mVertical = false;
 
-			getEvents().createEvent( "ValueChanged" );
-			getEvents()["ValueChanged"].add( new EventDelegate( this, &ScrollBar::onValueChanged ) );
+			//Set up events and default bindings
+			if ( gScrollBar_ClassEventList.empty() ) {
+				gScrollBar_ClassEventList.setParent( getEvents().getClassEvents() );
+				gScrollBar_ClassEventList.addEvent( Event_ValueChanged, &ScrollBar::onValueChanged );
+			}
+			getEvents().setClassEvents( &gScrollBar_ClassEventList );
 		}
 		//############################################################################
 		ScrollBar::~ScrollBar() {
@@ -210,7 +216,7 @@ namespace OpenGUI {
 		//############################################################################
 		void ScrollBar::eventValueChanged() {
 			EventArgs args;
-			triggerEvent( "ValueChanged", args );
+			triggerEvent( Event_ValueChanged, args );
 		}
 		//############################################################################
 		void ScrollBar::onValueChanged( Object* sender, EventArgs& evtArgs ) {
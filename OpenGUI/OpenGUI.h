@@ -38,6 +38,7 @@
 #include "OpenGUI_RenderTexture.h"
 #include "OpenGUI_TextureManager.h"
 #include "OpenGUI_RenderOperation.h"
+#include "OpenGUI_RenderCommandBuffer.h"
 #include "OpenGUI_Renderer.h"
 #include "OpenGUI_Viewport.h"
 
@@ -90,8 +91,11 @@
 #include "OpenGUI_Control.h"
 #include "OpenGUI_ContainerControl.h"
 #include "OpenGUI_Window.h"
+#include "OpenGUI_StackPanel.h"
+#include "OpenGUI_GridPanel.h"
 
 #include "OpenGUI_Screen.h"
 #include "OpenGUI_ScreenManager.h"
+#include "OpenGUI_Thread.h"
 
 #endif
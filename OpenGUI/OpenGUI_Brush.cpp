@@ -7,11 +7,9 @@
 #include "OpenGUI_Exception.h"
 #include "OpenGUI_Font.h"
 #include "OpenGUI_FontManager.h"
+#include "OpenGUI_TextureManager.h"
 
 namespace OpenGUI {
-	//initialize static variable
-	Brush* Brush::ActiveBrush = 0;
-
 	// BRUSH IMPLEMENTATIONS
 	//############################################################################
 	Brush::Brush() {
@@ -22,8 +20,7 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	Brush::~Brush() {
-		if ( this == ActiveBrush )
-			ActiveBrush = 0;
+		/**/
 	}
 	//############################################################################
 	/*! \see _popMarker() */
@@ -95,15 +92,11 @@ namespace OpenGUI {
 		m_RotationCacheValid = false; // we don't know what was popped, so we have to assume the worst
 	}
 	//############################################################################
+	/*! There is no shared notion of an active Brush, as Screens may be drawn on
+	several threads at once. Each Screen's RenderCommandBuffer tracks the context
+	that is selected within it instead. */
 	void Brush::markActive() {
-		if ( !isActive() ) {
-			ActiveBrush = this;
-			onActivate();
-		}
-	}
-	//############################################################################
-	bool Brush::isActive() {
-		return this == ActiveBrush;
+		onActivate();
 	}
 	//############################################################################
 	void Brush::_clear() {
@@ -389,9 +382,13 @@ namespace OpenGUI {
 	//############################################################################
 	//############################################################################
 	void BrushImagery::drawImage( const ImageryPtr& imageryPtr, const FRect& rect ) {
+		_drawTexturedRect( imageryPtr->getTexture(), rect, imageryPtr->getTextureUVRect() );
+	}
+	//############################################################################
+	void BrushImagery::_drawTexturedRect( const TexturePtr& texture, const FRect& rect, const FRect& UVRect ) {
 		RenderOperation renderOp;
 		renderOp.triangleList = new TriangleList;
-		renderOp.texture = imageryPtr->getTexture();
+		renderOp.texture = texture;
 		TriangleList& tl = *renderOp.triangleList;
 
 		FVector2 ul = rect.min;
@@ -399,7 +396,6 @@ namespace OpenGUI {
 		FVector2 ll = FVector2( rect.min.x, rect.max.y );
 		FVector2 lr = rect.max;
 
-		FRect UVRect = imageryPtr->getTextureUVRect();
 		FVector2 uv_ul = UVRect.min;
 		FVector2 uv_ur = FVector2( UVRect.max.x, UVRect.min.y );
 		FVector2 uv_ll = FVector2( UVRect.min.x, UVRect.max.y );
@@ -442,6 +438,17 @@ namespace OpenGUI {
 	void BrushImagery::drawImageTiled( const ImageryPtr& imageryPtr, const FRect& rect, float x_tiles, float y_tiles ) {
 		if ( x_tiles <= 0.0f || y_tiles <= 0.0f )
 			return; // we cannot run with garbage input
+
+		// if the imagery is the whole texture, we can let the renderer do the tiling
+		const FRect& UVRect = imageryPtr->getTextureUVRect();
+		if ( UVRect.min.x == 0.0f && UVRect.min.y == 0.0f && UVRect.max.x == 1.0f && UVRect.max.y == 1.0f ) {
+			TexturePtr texture = imageryPtr->getTexture();
+			if ( texture && !texture->isRenderTexture() && TextureManager::getSingleton().supportsTextureRepeat() ) {
+				_drawTexturedRect( texture, rect, FRect( 0.0f, 0.0f, x_tiles, y_tiles ) );
+				return;
+			}
+		}
+
 		FVector2 rect_size = rect.getSize();
 		const FVector2 tilesize( rect_size.x / x_tiles, rect_size.y / y_tiles );
 		IVector2 tilecount(( int )( rect_size.x / tilesize.x ), ( int )( rect_size.y / tilesize.y ) );
@@ -66,6 +66,8 @@ namespace OpenGUI {
 			mParentBrush = brush;
 		}
 		Brush* mParentBrush;
+		// draws a single quad covering rect, textured by uvRect
+		void _drawTexturedRect( const TexturePtr& texture, const FRect& rect, const FRect& uvRect );
 	public:
 		~BrushImagery() {}
 
@@ -76,6 +78,8 @@ namespace OpenGUI {
 		//! Draws the given Imagery at the given position at it's native pixel size
 		void drawImageUnscaled( const ImageryPtr& imageryPtr, const FVector2& position );
 		//! Draws the given Imagery filling the given rect using the given number of tiles
+		/*! If the Renderer supports texture repeat and the Imagery covers its entire texture,
+		this is drawn as a single quad. Otherwise one quad is drawn per tile, clipped to \c rect. */
 		void drawImageTiled( const ImageryPtr& imageryPtr, const FRect& rect, float x_tiles, float y_tiles );
 		//! Draws the given Imagery at the given position at it's native pixel size, tiling or clipping it as necessary to fill the area
 		void drawImageUnscaledAndTiled( const ImageryPtr& imageryPtr, const FRect& rect );
@@ -275,23 +279,24 @@ namespace OpenGUI {
 	protected:
 		//! Final output RenderOperations are passed to this function.
 		/*! It is up to specialized Brush implementations to capture final
-		output with this function. At this point, the Brush is guaranteed
-		to already to be active. */
+		output with this function. At this point, onActivate() has already
+		been called for this output. */
 		virtual void appendRenderOperation( RenderOperation& renderOp ) {
 			/* This is overridden by more specific brush classes */
 		}
 
-		//! Called automatically when this Brush becomes the active Brush
+		//! Called automatically before this Brush sends output or clears its render surface
+		/*! Brushes that render through a RenderCommandBuffer select their render context
+		here. The command buffer ignores selections of the context that is already selected,
+		so this is cheap to do every time. */
 		virtual void onActivate() = 0;
 
 		//! Called when this Brush has been told to clear the contents of its render surface
-		/*! The Brush is guaranteed to be active at this point */
+		/*! onActivate() has already been called at this point */
 		virtual void onClear() = 0;
 
-		//! Marks this brush as the active brush, if it is not already
+		//! Activates this brush, so that it can select its render context
 		void markActive();
-		//! returns \c true if this is marked as the active brush
-		bool isActive();
 
 		//! Clears the contents of this Brush's output target
 		/*! This is not something that most users would want to do. */
@@ -311,8 +316,6 @@ namespace OpenGUI {
 		FVector2 m_PPUcache; // cache for rotated PPU
 		FVector2 m_UPIcache; // cache for rotated UPI
 		void _UpdateRotationCache(); // updates the rotation dependent cache objects
-
-		static Brush* ActiveBrush;
 	};
 
 
@@ -108,7 +108,7 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Failed to find stack marker", __FUNCTION__ );
 
 		if ( mStack.front()->getType() == BrushModifier::MARKER ) {
-			BrushModifier_Marker* tmp = dynamic_cast<BrushModifier_Marker*>( mStack.front() );
+			BrushModifier_Marker* tmp = static_cast<BrushModifier_Marker*>( mStack.front() ); // getType() already told us what it is
 			void* t = tmp->mID;
 			if ( t == markerID ) {
 				mStack.pop_front();
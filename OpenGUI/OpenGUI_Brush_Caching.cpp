@@ -5,15 +5,18 @@
 #include "OpenGUI_Brush_Caching.h"
 #include "OpenGUI_Exception.h"
 #include "OpenGUI_Screen.h"
-#include "OpenGUI_Renderer.h"
+#include "OpenGUI_RenderCommandBuffer.h"
 #include "OpenGUI_TextureManager.h"
 
 namespace OpenGUI {
 	//############################################################################
-	Brush_Caching::Brush_Caching( Screen* parentScreen, const FVector2& size ): mScreen( parentScreen ), mDrawSize( size ) {
+	Brush_Caching::Brush_Caching( Screen* parentScreen, const FVector2& size, bool allowRTT ): mScreen( parentScreen ), mDrawSize( size ) {
+		mCurrentSegment = mSegments.end();
+		mDirtySegments = 0;
+		mRTTOperations = 0;
 		if ( !mScreen )
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Constructor requires a valid pointer to destination Screen", __FUNCTION__ );
-		if ( !initRTT() )
+		if ( !allowRTT || !initRTT() )
 			initMemory();
 		mHasContent = false;
 	}
@@ -34,11 +37,7 @@ namespace OpenGUI {
 	//############################################################################
 	const FVector2& Brush_Caching::getPPU_Raw() const {
 		if ( isRTT() ) {
-			static FVector2 retVal;
-			const IVector2& texsize = mRenderTexture->getSize();
-			retVal.x = ( float )texsize.x / mDrawSize.x;
-			retVal.y = ( float )texsize.y / mDrawSize.y;
-			return retVal;
+			return mRTTPPU;
 		} else {
 			return mScreen->getPPU();
 		}
@@ -71,6 +70,54 @@ namespace OpenGUI {
 			clearMemory();
 	}
 	//############################################################################
+	size_t Brush_Caching::getOperationCount() const {
+		if ( isRTT() )
+			return mRTTOperations;
+		size_t count = 0;
+		for ( SegmentList::const_iterator segment = mSegments.begin(); segment != mSegments.end(); segment++ )
+			count += segment->renderOps.size();
+		return count;
+	}
+	//############################################################################
+	void Brush_Caching::beginSegment( const void* key ) {
+		if ( isRTT() )
+			return;
+		SegmentMap::iterator found = mSegmentMap.find( key );
+		if ( found != mSegmentMap.end() ) {
+			mCurrentSegment = found->second;
+			mCurrentSegment->renderOps.clear();
+			if ( mCurrentSegment->dirty ) {
+				mCurrentSegment->dirty = false;
+				mDirtySegments--;
+			}
+		} else {
+			mCurrentSegment = mSegments.insert( mSegments.end(), Segment() );
+			mCurrentSegment->key = key;
+			mSegmentMap[key] = mCurrentSegment;
+		}
+	}
+	//############################################################################
+	void Brush_Caching::endSegment() {
+		mCurrentSegment = mSegments.end();
+	}
+	//############################################################################
+	bool Brush_Caching::dirtySegment( const void* key ) {
+		SegmentMap::iterator found = mSegmentMap.find( key );
+		if ( found == mSegmentMap.end() )
+			return false;
+		Segment& segment = *( found->second );
+		if ( !segment.dirty ) {
+			segment.dirty = true;
+			mDirtySegments++;
+		}
+		return true;
+	}
+	//############################################################################
+	bool Brush_Caching::isSegmentDirty( const void* key ) const {
+		SegmentMap::const_iterator found = mSegmentMap.find( key );
+		return found != mSegmentMap.end() && found->second->dirty;
+	}
+	//############################################################################
 	//############################################################################
 	//############################################################################
 	void Brush_Caching::initMemory() {
@@ -84,7 +131,10 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Brush_Caching::clearMemory() {
-		mRenderOpList.clear();
+		mSegments.clear();
+		mSegmentMap.clear();
+		mCurrentSegment = mSegments.end();
+		mDirtySegments = 0;
 	}
 	//############################################################################
 	void Brush_Caching::activateMemory() {
@@ -92,9 +142,12 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Brush_Caching::appendMemory( RenderOperation &renderOp ) {
+		if ( mCurrentSegment == mSegments.end() ) // output outside of any segment gets one of its own
+			mCurrentSegment = mSegments.insert( mSegments.end(), Segment() );
+		RenderOperationList& renderOps = mCurrentSegment->renderOps;
 		//!\todo fix me to perform triangle list appending when renderOps are equal
-		mRenderOpList.push_back( renderOp );
-		RenderOperation& newRop = mRenderOpList.back();
+		renderOps.push_back( renderOp );
+		RenderOperation& newRop = renderOps.back();
 		newRop.triangleList = new TriangleList;
 		TriangleList& inList = *( renderOp.triangleList );
 		TriangleList& outList = *( newRop.triangleList );
@@ -102,17 +155,19 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Brush_Caching::emergeMemory( Brush& targetBrush ) {
-		RenderOperationList::iterator iter, iterend = mRenderOpList.end();
-		for ( iter = mRenderOpList.begin(); iter != iterend; iter++ ) {
-			//!\todo Having a copy operation here makes this incredibly slow! This should be removed as part of Brush optimization
+		for ( SegmentList::iterator segment = mSegments.begin(); segment != mSegments.end(); segment++ ) {
+			RenderOperationList::iterator iter, iterend = segment->renderOps.end();
+			for ( iter = segment->renderOps.begin(); iter != iterend; iter++ ) {
+				//!\todo Having a copy operation here makes this incredibly slow! This should be removed as part of Brush optimization
 
-			// we need to make a copy because addrenderOperation modifies the input directly
-			RenderOperation &thisRop = ( *iter );
-			RenderOperation tmp = thisRop;
-			tmp.triangleList = new TriangleList;
-			*( tmp.triangleList ) = *( thisRop.triangleList );
+				// we need to make a copy because addrenderOperation modifies the input directly
+				RenderOperation &thisRop = ( *iter );
+				RenderOperation tmp = thisRop;
+				tmp.triangleList = new TriangleList;
+				*( tmp.triangleList ) = *( thisRop.triangleList );
 
-			targetBrush._addRenderOperation( tmp );
+				targetBrush._addRenderOperation( tmp );
+			}
 		}
 	}
 	//############################################################################
@@ -123,20 +178,20 @@ namespace OpenGUI {
 			return false;
 
 		IVector2 texSize;
-		float xTexSize, yTexSize, xPixelSize, yPixelSize;
+		float xPixelSize, yPixelSize;
 		xPixelSize = mDrawSize.x * getPPU_Raw().x;
 		yPixelSize = mDrawSize.y * getPPU_Raw().y;
-		xTexSize = Math::Ceil( xPixelSize );
-		yTexSize = Math::Ceil( yPixelSize );
-		mMaxUV.x = xPixelSize / xTexSize;
-		mMaxUV.y = yPixelSize / yTexSize;
-
-		texSize.x = ( int )( xTexSize );
-		texSize.y = ( int )( yTexSize );
+		texSize.x = ( int )( Math::Ceil( xPixelSize ) );
+		texSize.y = ( int )( Math::Ceil( yPixelSize ) );
 
 		mRenderTexture = TextureManager::getSingleton().createRenderTexture( texSize );
 		if ( !mRenderTexture )
 			return false;
+		// pooled render textures can be larger than requested, so we only use the upper left of it
+		mMaxUV.x = xPixelSize / ( float )mRenderTexture->getSize().x;
+		mMaxUV.y = yPixelSize / ( float )mRenderTexture->getSize().y;
+		mRTTPPU.x = ( float )mRenderTexture->getSize().x * mMaxUV.x / mDrawSize.x;
+		mRTTPPU.y = ( float )mRenderTexture->getSize().y * mMaxUV.y / mDrawSize.y;
 		_clear();
 		return true;
 	}
@@ -146,11 +201,12 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Brush_Caching::clearRTT() {
-		Renderer::getSingleton().clearContents();
+		mRTTOperations = 0;
+		mScreen->_getCommandBuffer().clearContents();
 	}
 	//############################################################################
 	void Brush_Caching::activateRTT() {
-		Renderer::getSingleton().selectRenderContext( mRenderTexture.get() );
+		mScreen->_getCommandBuffer().selectRenderContext( mRenderTexture.get() );
 	}
 	//############################################################################
 	void Brush_Caching::appendRTT( RenderOperation &renderOp ) {
@@ -158,11 +214,12 @@ namespace OpenGUI {
 		for ( iter = renderOp.triangleList->begin(); iter != iterend; iter++ ) {
 			Triangle& t = ( *iter );
 			for ( int i = 0; i < 3; i++ ) {
-				t.vertex[i].position.x /= mDrawSize.x;
-				t.vertex[i].position.y /= mDrawSize.y;
+				t.vertex[i].position.x *= mMaxUV.x / mDrawSize.x;
+				t.vertex[i].position.y *= mMaxUV.y / mDrawSize.y;
 			}
 		}
-		Renderer::getSingleton().doRenderOperation( renderOp );
+		mScreen->_getCommandBuffer().addRenderOperation( renderOp );
+		mRTTOperations++;
 	}
 	//############################################################################
 	void Brush_Caching::emergeRTT( Brush& targetBrush ) {
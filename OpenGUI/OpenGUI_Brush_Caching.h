@@ -19,7 +19,8 @@ namespace OpenGUI {
 	class OPENGUI_API Brush_Caching: public Brush {
 	public:
 		//! Constructor requires a pointer to the Screen that this Brush will eventually be drawn to
-		Brush_Caching( Screen* parentScreen, const FVector2& size );
+		/*! If \c allowRTT is \c false, memory storage is used even when render textures are available. */
+		Brush_Caching( Screen* parentScreen, const FVector2& size, bool allowRTT = true );
 		//! Destructor
 		virtual ~Brush_Caching();
 
@@ -48,6 +49,29 @@ namespace OpenGUI {
 		bool hasContent() const {
 			return mHasContent;
 		}
+		//! returns the number of render operations recorded into this cache since it was last cleared
+		/*! For memory caches this is the number that will be emerged. RTT caches emerge a single
+		operation regardless, so this is the number that drawing the content without a cache would cost. */
+		size_t getOperationCount() const;
+
+		//! Starts recording into the segment identified by \c key, replacing anything it already held
+		/*! Segments allow part of a memory cache to be recorded again without clearing the rest.
+		They are emerged in the order they were first begun, and any output recorded outside of a
+		segment keeps its place between them. RTT caches do not keep segments, and ignore this. */
+		void beginSegment( const void* key );
+		//! Ends the segment started by beginSegment()
+		void endSegment();
+		//! Marks the segment identified by \c key as needing to be recorded again
+		/*! Returns \c false if this cache cannot record that segment alone, either because it is
+		an RTT cache or because no such segment has been recorded. The entire cache must then be
+		cleared and recorded again instead. */
+		bool dirtySegment( const void* key );
+		//! returns \c true if the segment identified by \c key has been marked by dirtySegment()
+		bool isSegmentDirty( const void* key ) const;
+		//! returns \c true if any segment has been marked by dirtySegment() and not recorded since
+		bool hasDirtySegments() const {
+			return mDirtySegments > 0;
+		}
 
 	protected:
 		virtual void appendRenderOperation( RenderOperation &renderOp );
@@ -72,9 +96,23 @@ namespace OpenGUI {
 		Screen* mScreen;
 		FVector2 mDrawSize;
 		FVector2 mMaxUV;
-		RenderOperationList mRenderOpList;
+		FVector2 mRTTPPU; // PPU of mRenderTexture
 		RenderTexturePtr mRenderTexture;
 		bool mHasContent;
+		size_t mRTTOperations; // operations rendered into mRenderTexture since the last clear
+
+		struct Segment {
+			Segment(): key( 0 ), dirty( false ) {}
+			const void* key; // 0 for output recorded outside of any segment
+			bool dirty;
+			RenderOperationList renderOps;
+		};
+		typedef std::list<Segment> SegmentList;
+		typedef std::map<const void*, SegmentList::iterator> SegmentMap;
+		SegmentList mSegments; // memory storage, in emerge order
+		SegmentMap mSegmentMap; // keyed segments within mSegments
+		SegmentList::iterator mCurrentSegment; // segment being recorded, or mSegments.end() if none
+		size_t mDirtySegments;
 	};
 } // namespace OpenGUI{
 
@@ -5,7 +5,7 @@
 #include "OpenGUI_Brush_RTT.h"
 #include "OpenGUI_Exception.h"
 #include "OpenGUI_Screen.h"
-#include "OpenGUI_Renderer.h"
+#include "OpenGUI_RenderCommandBuffer.h"
 #include "OpenGUI_TextureManager.h"
 
 namespace OpenGUI {
@@ -15,19 +15,16 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Constructor requires a valid pointer to destination Screen", __FUNCTION__ );
 		mHasContent = false;
 		IVector2 texSize;
-		float xTexSize, yTexSize, xPixelSize, yPixelSize;
+		float xPixelSize, yPixelSize;
 		xPixelSize = mDrawSize.x * getPPU_Raw().x;
 		yPixelSize = mDrawSize.y * getPPU_Raw().y;
-		xTexSize = Math::Ceil( xPixelSize );
-		yTexSize = Math::Ceil( yPixelSize );
-		mMaxUV.x = xPixelSize / xTexSize;
-		mMaxUV.y = yPixelSize / yTexSize;
-
-		texSize.x = ( int )( xTexSize );
-		texSize.y = ( int )( yTexSize );
+		texSize.x = ( int )( Math::Ceil( xPixelSize ) );
+		texSize.y = ( int )( Math::Ceil( yPixelSize ) );
 		mRenderTexture = TextureManager::getSingleton().createRenderTexture( texSize );
 		if ( !mRenderTexture )
 			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Failed to create valid render texture", __FUNCTION__ );
+		mMaxUV.x = xPixelSize / ( float )mRenderTexture->getSize().x;
+		mMaxUV.y = yPixelSize / ( float )mRenderTexture->getSize().y;
 		_clear();
 	}
 	//############################################################################
@@ -77,21 +74,21 @@ namespace OpenGUI {
 		for ( iter = renderOp.triangleList->begin(); iter != iterend; iter++ ) {
 			Triangle& t = ( *iter );
 			for ( int i = 0; i < 3; i++ ) {
-				t.vertex[i].position.x /= mDrawSize.x;
-				t.vertex[i].position.y /= mDrawSize.y;
+				t.vertex[i].position.x *= mMaxUV.x / mDrawSize.x;
+				t.vertex[i].position.y *= mMaxUV.y / mDrawSize.y;
 			}
 		}
-		Renderer::getSingleton().doRenderOperation( renderOp );
+		mScreen->_getCommandBuffer().addRenderOperation( renderOp );
 		mHasContent = true;
 	}
 	//############################################################################
 	void Brush_RTT::onActivate() {
-		Renderer::getSingleton().selectRenderContext( mRenderTexture.get() );
+		mScreen->_getCommandBuffer().selectRenderContext( mRenderTexture.get() );
 	}
 	//############################################################################
 	void Brush_RTT::onClear() {
 		mHasContent = false;
-		Renderer::getSingleton().clearContents();
+		mScreen->_getCommandBuffer().clearContents();
 	}
 	//############################################################################
 } // namespace OpenGUI{
@@ -88,4 +88,26 @@ This section is copied verbatim from OpenGUI_CONFIG.h:
 #define DYNAMICLIB_FILENAME_MANGLING 1
 
 
+//###########################################################################################
+//###########################################################################################
+//###########################################################################################
+
+//*************************//
+//   THREADING SETTINGS    //
+//*************************//
+// This setting allows Screens to be drawn on more than one thread, either by the worker
+// threads of ScreenManager::setUpdateThreads(), or by calling ScreenManager::submitScreens()
+// from a different thread than ScreenManager::recordScreens().
+//
+// It makes every reference count change atomic, and makes the TextureManager and the font
+// cache take a lock on every call, which slows down applications that only ever draw from
+// one thread. Without it, setUpdateThreads() leaves Screens on the calling thread, and
+// recordScreens() and submitScreens() must be called from the same thread.
+//
+// This must be set the same way for OpenGUI and everything built against it.
+//
+// To turn on, uncomment. To turn off, just comment out.
+// #define OPENGUI_THREADED_UPDATE
+
+
 #endif
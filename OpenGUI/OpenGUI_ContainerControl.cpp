@@ -4,12 +4,22 @@
 
 #include "OpenGUI_ContainerControl.h"
 #include "OpenGUI_Brush_Caching.h"
+#include "OpenGUI_TextureManager.h"
+#include "OpenGUI_Screen.h"
 #include "OpenGUI_Macros.h"
 
 namespace OpenGUI {
+	static const EventID Event_DrawBG( "DrawBG" );
+	static const EventID Event_ChildAttached( "ChildAttached" );
+	static const EventID Event_ChildDetached( "ChildDetached" );
+	static const EventID Event_InvalidatedChild( "InvalidatedChild" );
+	static const EventID Event_Detached( "Detached" );
+	static const EventID Event_Attached( "Attached" );
+	//############################################################################
 
 	SimpleProperty_Float( property_Padding, "Padding", ContainerControl, getPadding, setPadding );
 	SimpleProperty_Bool( property_ConsumeInput, "ConsumeInput", ContainerControl, getConsumeInput, setConsumeInput );
+	SimpleProperty_Integer( property_CachePolicy, "CachePolicy", ContainerControl, getCachePolicy, setCachePolicy );
 
 	//############################################################################
 	class ContainerControl_ObjectAccessorList : public ObjectAccessorList {
@@ -17,10 +27,21 @@ namespace OpenGUI {
 		ContainerControl_ObjectAccessorList() {
 			addAccessor( &property_Padding );
 			addAccessor( &property_ConsumeInput );
+			addAccessor( &property_CachePolicy );
 		}
 		~ContainerControl_ObjectAccessorList() {}
 	}
 	gContainerControl_ObjectAccessorList;
+	ClassEventList gContainerControl_ClassEventList;
+
+	// CacheAuto tuning. Separate thresholds for entering and leaving a policy keep
+	// content that sits near a threshold from switching back and forth.
+	static const unsigned int CACHE_WINDOW = 30; // draws measured before the policy is reconsidered
+	static const float CACHE_NONE_ENTER = 0.75f; // redraw fraction at which recording stops paying for itself
+	static const float CACHE_NONE_LEAVE = 0.5f;
+	static const float CACHE_RTT_ENTER = 0.05f; // change rate at which content is static enough for a render texture
+	static const float CACHE_RTT_LEAVE = 0.2f;
+	static const unsigned int CACHE_RTT_MIN_OPERATIONS = 8; // below this a render target switch costs more than it saves
 
 	//############################################################################
 	//############################################################################
@@ -28,6 +49,7 @@ namespace OpenGUI {
 
 	//############################################################################
 	ContainerControl::ContainerControl() {
+		_addObjectKind( KIND_CONTAINERCONTROL );
 		if ( gContainerControl_ObjectAccessorList.getParent() == 0 )
 			gContainerControl_ObjectAccessorList.setParent( Control::getAccessors() );
 
@@ -35,26 +57,42 @@ namespace OpenGUI {
 		Children.setParent( this );
 		Children.attachListener( this );
 		mCacheBrush = 0;
+		m_InChildInvalidation = false;
+		mCachePolicy = CacheAuto;
+		mActiveCachePolicy = CacheMemory; // measure before considering anything else
+		mCacheWholeDirty = true;
+		mCacheDirtyChildren = 0;
+		mCacheDraws = 0;
+		mCacheChangedDraws = 0;
+		mCacheRedrawSum = 0.0f;
+		mCacheOperations = 0;
+		mStatCacheChangeRate = 0.0f;
+		mStatCacheRedrawFraction = 0.0f;
 		m_LayoutSuspended = false; // layouts are instantaneous by default
 		m_LayoutValid = true; // layout begins valid (as there are no controls to update, it does not matter)
 		m_InUpdateLayout = false; // we are not in updateLayout() quite yet
+		m_ChildLayoutPending = false; // no children have been added that could need layouts
+		m_LayoutQueued = false; // nothing is queued with a Screen yet
 		m_ClipChildren = false;
 		mConsumeInput = true; // by default we consume all appropriate input to prevent it from reaching overdrawn widgets
+		mPadding = 0.0f; // no padding by default
 
 		// set up defaults for properties
 
 		//Set up events and default bindings
-		getEvents().createEvent( "DrawBG" );
-		getEvents()["DrawBG"].add( new EventDelegate( this, &ContainerControl::onDrawBG ) );
-		getEvents().createEvent( "ChildAttached" );
-		getEvents().createEvent( "ChildDetached" );
-		getEvents()["ChildAttached"].add( new EventDelegate( this, &ContainerControl::onChildAttached ) );
-		getEvents()["ChildDetached"].add( new EventDelegate( this, &ContainerControl::onChildDetached ) );
-		getEvents().createEvent( "InvalidatedChild" );
-		getEvents()["InvalidatedChild"].add( new EventDelegate( this, &ContainerControl::onInvalidatedChild ) );
+		if ( gContainerControl_ClassEventList.empty() ) {
+			gContainerControl_ClassEventList.setParent( getEvents().getClassEvents() );
+			gContainerControl_ClassEventList.addEvent( Event_DrawBG, &ContainerControl::onDrawBG );
+			gContainerControl_ClassEventList.addEvent( Event_ChildAttached, &ContainerControl::onChildAttached );
+			gContainerControl_ClassEventList.addEvent( Event_ChildDetached, &ContainerControl::onChildDetached );
+			gContainerControl_ClassEventList.addEvent( Event_InvalidatedChild, &ContainerControl::onInvalidatedChild );
 
-		//additional (unblockable) event bindings
-		getEvents()["Detached"].add( new EventDelegate( this, &ContainerControl::onDetached_BrushCache ) );
+			//additional (unblockable) event bindings
+			gContainerControl_ClassEventList.addEvent( Event_Detached, &ContainerControl::onDetached_BrushCache );
+			gContainerControl_ClassEventList.addEvent( Event_Attached, &ContainerControl::onAttached_Layout );
+			gContainerControl_ClassEventList.addEvent( Event_Detached, &ContainerControl::onDetached_Layout );
+		}
+		getEvents().setClassEvents( &gContainerControl_ClassEventList );
 	}
 	//############################################################################
 	ContainerControl::~ContainerControl() {
@@ -78,57 +116,67 @@ namespace OpenGUI {
 	//############################################################################
 	void ContainerControl::eventDrawBG( Brush& brush ) {
 		Draw_EventArgs event( brush );
-		triggerEvent( "DrawBG", event );
+		triggerEvent( Event_DrawBG, event );
 	}
 	//############################################################################
 	void ContainerControl::onChildAttached( Object* sender, Attach_EventArgs& evtArgs ) {
-		invalidate(); // need to invalidate caches for hierarchy change
+		_invalidateCache(); // need to invalidate caches for hierarchy change (the collection reports the child's area)
+		_invalidatedChildMeasure();
 	}
 	//############################################################################
 	void ContainerControl::eventChildAttached( WidgetCollection* container, Widget* newChild ) {
 		Attach_EventArgs event( container, newChild );
-		triggerEvent( "ChildAttached", event );
+		triggerEvent( Event_ChildAttached, event );
 	}
 	//############################################################################
 	void ContainerControl::onChildDetached( Object* sender, Attach_EventArgs& evtArgs ) {
-		invalidate(); // need to invalidate caches for hierarchy change
+		_invalidateCache(); // need to invalidate caches for hierarchy change (the collection reports the child's area)
+		_invalidatedChildMeasure();
 	}
 	//############################################################################
 	void ContainerControl::eventChildDetached( WidgetCollection* container, Widget* prevChild ) {
 		Attach_EventArgs event( container, prevChild );
-		triggerEvent( "ChildDetached", event );
+		triggerEvent( Event_ChildDetached, event );
 	}
 	//############################################################################
 	void ContainerControl::_draw( Brush& brush ) {
 		if ( getVisible() ) {
+			_measureCacheUse();
+
+			if ( mActiveCachePolicy == CacheNone ) {
+				// draw straight into the output, clipped to our rect just as a cache would be
+				brush.pushAlpha( getAlpha() );
+				brush.pushPosition( getPosition() );
+				brush.pushClippingRect( FRect( 0.0f, 0.0f, getWidth(), getHeight() ) );
+				_drawContent( brush, 0 );
+				brush.pop(); // pop clipping rect
+				brush.pop(); // pop position offset
+				brush.pop(); // pop alpha
+				return;
+			}
 
 			Brush_Caching& cacheBrush = _getCacheBrush();
 
 			// do we need to rebuild the cache brush?
 			if ( isCacheDirty() ) {
-				cacheBrush.pushPosition( -getPosition() ); //offset to parent coords for Container drawing
-				//draw background
-				cacheBrush._pushMarker( this );
-				eventDrawBG( cacheBrush );
-				cacheBrush._popMarker( this );
-				cacheBrush.pop(); // pop the parent coords offset
-
-				//draw children
-				if ( m_ClipChildren ) // setup the client area clip if we have one
+				_drawContent( cacheBrush, &cacheBrush );
+				mCacheOperations = ( unsigned int ) cacheBrush.getOperationCount();
+
+			} else if ( cacheBrush.hasDirtySegments() ) {
+				// only redraw the children that were invalidated, under the same clip as before
+				if ( m_ClipChildren )
 					cacheBrush.pushClippingRect( getClientArea() );
 				WidgetCollection::reverse_iterator iter, iterend = Children.rend();
 				for ( iter = Children.rbegin(); iter != iterend; iter++ ) {
+					if ( !cacheBrush.isSegmentDirty( iter.get() ) )
+						continue;
+					cacheBrush.beginSegment( iter.get() );
 					iter->_draw( cacheBrush );
+					cacheBrush.endSegment();
 				}
-				if ( m_ClipChildren ) // pop the client area clip if we had one
+				if ( m_ClipChildren )
 					cacheBrush.pop();
-
-				cacheBrush.pushPosition( -getPosition() ); //offset to parent coords for Container drawing
-				//draw foreground
-				cacheBrush._pushMarker( this );
-				eventDraw( cacheBrush );
-				cacheBrush._popMarker( this );
-				cacheBrush.pop(); // pop the parent coords offset
+				_validate(); // our own output was kept, so our next invalidation must be reported again
 			}
 
 			//push cache into output stream
@@ -140,17 +188,108 @@ namespace OpenGUI {
 		}
 	}
 	//############################################################################
-	/*! If layout is not suspended, this triggers an immediate update of the layout.
+	/*! The \c brush is expected to be in local coordinates. If \c segments is given, the
+	output of each child is recorded into its own segment of that cache. */
+	void ContainerControl::_drawContent( Brush& brush, Brush_Caching* segments ) {
+		brush.pushPosition( -getPosition() ); //offset to parent coords for Container drawing
+		//draw background
+		brush._pushMarker( this );
+		eventDrawBG( brush );
+		brush._popMarker( this );
+		brush.pop(); // pop the parent coords offset
+
+		//draw children
+		if ( m_ClipChildren ) // setup the client area clip if we have one
+			brush.pushClippingRect( getClientArea() );
+		WidgetCollection::reverse_iterator iter, iterend = Children.rend();
+		for ( iter = Children.rbegin(); iter != iterend; iter++ ) {
+			if ( segments ) // each child is kept separately, so it can be redrawn alone
+				segments->beginSegment( iter.get() );
+			iter->_draw( brush );
+			if ( segments )
+				segments->endSegment();
+		}
+		if ( m_ClipChildren ) // pop the client area clip if we had one
+			brush.pop();
+
+		brush.pushPosition( -getPosition() ); //offset to parent coords for Container drawing
+		//draw foreground
+		brush._pushMarker( this );
+		eventDraw( brush );
+		brush._popMarker( this );
+		brush.pop(); // pop the parent coords offset
+	}
+	//############################################################################
+	/*! If layout is not suspended, this queues a layout update that will be performed
+	by the owning Screen at the start of its next update(), so any number of invalidations
+	within a frame cost a single layout pass. Containers that are not attached to a Screen
+	have no one to perform the queued update, so they still update immediately.
 	This function is protected from re-entry when a layout operation is currently
 	under way. */
 	void ContainerControl::invalidateLayout() {
 		if ( !m_InUpdateLayout ) {
 			m_LayoutValid = false;
-			if ( !m_LayoutSuspended )
-				updateLayout();
+			if ( m_LayoutSuspended )
+				return;
+			if ( m_LayoutQueued ) {
+				if ( getScreen() )
+					return; // the Screen will get to it
+				m_LayoutQueued = false; // an ancestor was detached while we were queued
+			}
+			_queueLayout();
+		}
+	}
+	//############################################################################
+	/*! Every container between here and the Screen is marked as having a child in
+	need of layout, so that Screen::_resolveLayouts() can walk straight down to the
+	containers that need work without visiting clean branches. */
+	void ContainerControl::_queueLayout() {
+		Screen* screen = getScreen();
+		if ( !screen ) {
+			_resolveLayout();
+			return;
+		}
+		ContainerControl* parent = ContainerControl::_cast( getParent() );
+		while ( parent ) {
+			parent->m_ChildLayoutPending = true;
+			parent = ContainerControl::_cast( parent->getParent() );
+		}
+		m_LayoutQueued = true;
+		screen->_queueLayout();
+	}
+	//############################################################################
+	/*! Layouts are resolved top-down, so a container's own layout is always settled
+	before its children lay out within the sizes it gave them. */
+	void ContainerControl::_resolveLayout() {
+		m_LayoutQueued = false;
+		if ( !m_LayoutSuspended )
+			updateLayout();
+		if ( m_ChildLayoutPending ) {
+			m_ChildLayoutPending = false;
+			WidgetCollection::iterator iter, iterend = Children.end();
+			for ( iter = Children.begin(); iter != iterend; iter++ ) {
+				ContainerControl* child = ContainerControl::_cast( iter.get() );
+				if ( child )
+					child->_resolveLayout();
+			}
 		}
 	}
 	//############################################################################
+	void ContainerControl::_invalidatedChildMeasure() {
+		/* Docking and anchoring do not depend on the desired size of children */
+	}
+	//############################################################################
+	void ContainerControl::onAttached_Layout( Object* sender, Attach_EventArgs& evtArgs ) {
+		// anything left pending from a previous Screen needs to be queued with the new one
+		if (( !m_LayoutValid && !m_LayoutSuspended ) || m_ChildLayoutPending )
+			_queueLayout();
+	}
+	//############################################################################
+	void ContainerControl::onDetached_Layout( Object* sender, Attach_EventArgs& evtArgs ) {
+		// the Screen we were queued with will no longer reach us
+		m_LayoutQueued = false;
+	}
+	//############################################################################
 	void ContainerControl::suspendLayout() {
 		m_LayoutSuspended = true;
 	}
@@ -169,13 +308,12 @@ namespace OpenGUI {
 	from the defined offsets \c m_ClientAreaOffset_UL and \c m_ClientAreaOffset_LR.
 	*/
 	const FRect& ContainerControl::getClientArea() {
-		static FRect retval;
 		FVector2 size = getSize();
-		retval.min.x = m_ClientAreaOffset_UL.x;
-		retval.min.y = m_ClientAreaOffset_UL.y;
-		retval.max.x = size.x + m_ClientAreaOffset_LR.x;
-		retval.max.y = size.y + m_ClientAreaOffset_LR.y;
-		return retval;
+		mClientArea.min.x = m_ClientAreaOffset_UL.x;
+		mClientArea.min.y = m_ClientAreaOffset_UL.y;
+		mClientArea.max.x = size.x + m_ClientAreaOffset_LR.x;
+		mClientArea.max.y = size.y + m_ClientAreaOffset_LR.y;
+		return mClientArea;
 	}
 	//############################################################################
 	/*! The update is performed regardless of layout being currently suspended,
@@ -195,7 +333,7 @@ namespace OpenGUI {
 	void ContainerControl::_setChildControlLayoutState( bool state ) {
 		WidgetCollection::iterator iter, iterend = Children.end();
 		for ( iter = Children.begin(); iter != iterend; iter++ ) {
-			Control* c = dynamic_cast<Control*>( iter.get() );
+			Control* c = Control::_cast( iter.get() );
 			if ( c )
 				c->m_InLayout = state;
 		}
@@ -217,7 +355,7 @@ namespace OpenGUI {
 		//update all docked controls
 		WidgetCollection::iterator iter, iterend = Children.end();
 		for ( iter = Children.begin(); iter != iterend; iter++ ) {
-			Control* ctrl = dynamic_cast<Control*>( iter.get() );
+			Control* ctrl = Control::_cast( iter.get() );
 			if ( ctrl ) {
 				int dock = ctrl->getDocking();
 				float margin = ctrl->getMargin();
@@ -273,7 +411,7 @@ namespace OpenGUI {
 
 		//WidgetCollection::iterator iter, iterend = Children.end(); // done earlier
 		for ( iter = Children.begin(); iter != iterend; iter++ ) {
-			Control* ctrl = dynamic_cast<Control*>( iter.get() );
+			Control* ctrl = Control::_cast( iter.get() );
 			if ( ctrl ) {
 				int dock = ctrl->getDocking();
 				if ( dock == Control::None ) {
@@ -305,15 +443,14 @@ namespace OpenGUI {
 		FVector2 pos = position;
 		_translatePointIn( pos );
 
-		WidgetCollection::iterator iter, iterend = Children.end();
-		for ( iter = Children.begin(); iter != iterend; iter++ ) {
-			Widget* child = iter.get();
-			if ( child->isInside( pos ) ) {
-				if ( recursive ) {
-					child->getChildrenAt( pos, outList, true );
-				}
-				outList.push_back( child );
+		WidgetPtrList hits;
+		Children.getWidgetsAt( pos, hits );
+		for ( WidgetPtrList::iterator iter = hits.begin(); iter != hits.end(); iter++ ) {
+			Widget* child = ( *iter );
+			if ( recursive ) {
+				child->getChildrenAt( pos, outList, true );
 			}
+			outList.push_back( child );
 		}
 	}
 	//############################################################################
@@ -321,26 +458,28 @@ namespace OpenGUI {
 		FVector2 pos = position;
 		_translatePointIn( pos );
 
-		WidgetCollection::iterator iter, iterend = Children.end();
-		for ( iter = Children.begin(); iter != iterend; iter++ ) {
-			Widget* child = iter.get();
-			if ( child->isInside( pos ) ) {
-				Widget* ret = child;
-				if ( recursive ) {
-					child = child->getChildAt( pos, true );
-					if ( child )
-						ret = child;
-				}
-				return ret;
-			}
+		Widget* ret = Children.getWidgetAt( pos );
+		if ( ret && recursive ) {
+			Widget* child = ret->getChildAt( pos, true );
+			if ( child )
+				ret = child;
 		}
-		return 0;
+		return ret;
 	}
 	//############################################################################
-	void ContainerControl::_invalidatedChild() {
+	/*! Memory caches keep the output of each child in its own segment, so only that segment
+	needs to be recorded again. Caches that cannot do that are flushed entirely. */
+	void ContainerControl::_invalidatedChild( Widget* child ) {
+		mCacheDirtyChildren++;
+		if ( mCacheBrush && !mCacheBrush->dirtySegment( child ) )
+			dirtyCache();
 		eventInvalidatedChild();
 	}
 	//############################################################################
+	bool ContainerControl::_isChildCacheDirty( Widget* child ) const {
+		return !mCacheBrush || mCacheBrush->isSegmentDirty( child );
+	}
+	//############################################################################
 	void ContainerControl::dirtyCache() {
 		if ( mCacheBrush ) {
 			delete mCacheBrush;
@@ -356,11 +495,91 @@ namespace OpenGUI {
 	//############################################################################
 	Brush_Caching& ContainerControl::_getCacheBrush() {
 		if ( !mCacheBrush ) {
-			mCacheBrush = new Brush_Caching( getScreen(), getSize() );
+			mCacheBrush = new Brush_Caching( getScreen(), getSize(), mActiveCachePolicy == CacheRTT );
 		}
 		return *mCacheBrush;
 	}
 	//############################################################################
+	/*! Invalid values throw an Exception. The new policy takes effect with the next draw.
+	Choosing \c CacheAuto restarts measurement from a memory cache. */
+	void ContainerControl::setCachePolicy( int policy ) {
+		if ( policy < CacheAuto || policy > CacheRTT )
+			OG_THROW( Exception::ERR_INVALIDPARAMS, "Unknown CachePolicy", __FUNCTION__ );
+		if ( mCachePolicy == policy ) return;
+		mCachePolicy = policy;
+		mActiveCachePolicy = policy == CacheAuto ? CacheMemory : policy;
+		mCacheDraws = 0;
+		mCacheChangedDraws = 0;
+		mCacheRedrawSum = 0.0f;
+		invalidate();
+	}
+	//############################################################################
+	int ContainerControl::getCachePolicy() {
+		return mCachePolicy;
+	}
+	//############################################################################
+	/*! A \c CacheRTT container reports \c CacheMemory if the Renderer lacks render texture support,
+	as that is where Brush_Caching will keep its content. */
+	int ContainerControl::getActiveCachePolicy() {
+		if ( mActiveCachePolicy == CacheRTT && mCacheBrush && mCacheBrush->isMemory() )
+			return CacheMemory;
+		return mActiveCachePolicy;
+	}
+	//############################################################################
+	float ContainerControl::statsGetCacheChangeRate() {
+		return mStatCacheChangeRate;
+	}
+	//############################################################################
+	float ContainerControl::statsGetCacheRedrawFraction() {
+		return mStatCacheRedrawFraction;
+	}
+	//############################################################################
+	unsigned int ContainerControl::statsGetCacheOperations() {
+		return mCacheOperations;
+	}
+	//############################################################################
+	/*! The redrawn fraction of a draw is 1.0f if the container itself was invalidated,
+	otherwise it is the share of children that were. These are counted the same way
+	regardless of the policy in effect, so policies can be compared fairly. */
+	void ContainerControl::_measureCacheUse() {
+		float redraw = 0.0f;
+		if ( mCacheWholeDirty ) {
+			redraw = 1.0f;
+		} else if ( mCacheDirtyChildren > 0 ) {
+			size_t children = Children.size();
+			redraw = mCacheDirtyChildren >= children ? 1.0f : ( float ) mCacheDirtyChildren / ( float ) children;
+		}
+		if ( mCacheWholeDirty || mCacheDirtyChildren > 0 )
+			mCacheChangedDraws++;
+		mCacheRedrawSum += redraw;
+		mCacheWholeDirty = false;
+		mCacheDirtyChildren = 0;
+
+		if ( ++mCacheDraws < CACHE_WINDOW )
+			return;
+		mStatCacheChangeRate = ( float ) mCacheChangedDraws / ( float ) mCacheDraws;
+		mStatCacheRedrawFraction = mCacheRedrawSum / ( float ) mCacheDraws;
+		mCacheDraws = 0;
+		mCacheChangedDraws = 0;
+		mCacheRedrawSum = 0.0f;
+		if ( mCachePolicy != CacheAuto )
+			return;
+
+		int policy = CacheMemory;
+		float noneThreshold = mActiveCachePolicy == CacheNone ? CACHE_NONE_LEAVE : CACHE_NONE_ENTER;
+		float rttThreshold = mActiveCachePolicy == CacheRTT ? CACHE_RTT_LEAVE : CACHE_RTT_ENTER;
+		TextureManager* tm = TextureManager::getSingletonPtr();
+		if ( mStatCacheRedrawFraction >= noneThreshold )
+			policy = CacheNone;
+		else if ( tm && tm->supportsRenderToTexture() && mCacheOperations >= CACHE_RTT_MIN_OPERATIONS
+				  && mStatCacheChangeRate <= rttThreshold )
+			policy = CacheRTT;
+		if ( policy != mActiveCachePolicy ) {
+			mActiveCachePolicy = policy;
+			dirtyCache();
+		}
+	}
+	//############################################################################
 	void ContainerControl::_tick( float seconds ) {
 		Control::_tick( seconds );
 		WidgetCollection::iterator iter, iterend = Children.end();
@@ -372,16 +591,21 @@ namespace OpenGUI {
 	//############################################################################
 	void ContainerControl::eventInvalidatedChild() {
 		EventArgs event;
-		triggerEvent( "InvalidatedChild", event );
+		triggerEvent( Event_InvalidatedChild, event );
 	}
 	//############################################################################
 	void ContainerControl::onInvalidated( Object* sender, EventArgs& evtArgs ) {
-		dirtyCache();
+		if ( !m_InChildInvalidation ) {
+			mCacheWholeDirty = true;
+			dirtyCache();
+		}
 		Control::onInvalidated( sender, evtArgs );
 	}
 	//############################################################################
 	void ContainerControl::onInvalidatedChild( Object* sender, EventArgs& evtArgs ) {
-		invalidate();
+		m_InChildInvalidation = true;
+		_invalidateCache(); // the child has already reported its own area
+		m_InChildInvalidation = false;
 	}
 	//############################################################################
 	void ContainerControl::onDetached_BrushCache( Object* sender, Attach_EventArgs& evtArgs ) {
@@ -417,6 +641,7 @@ namespace OpenGUI {
 		if ( padding < 0.0f ) padding = 0.0f;
 		if ( mPadding == padding ) return;
 		mPadding = padding;
+		invalidateMeasure();
 		invalidateLayout();
 	}
 	//############################################################################
@@ -453,10 +678,7 @@ namespace OpenGUI {
 		_translatePointIn( point );
 		Cursor_EventArgs localEvent( point.x, point.y );
 		if ( moveEvent.Consumed ) localEvent.eat();
-		WidgetCollection::iterator i, ie = Children.end();
-		for ( i = Children.begin(); i != ie; i++ ) {
-			i->_injectCursorMove( localEvent );
-		}
+		Children._injectCursorMove( localEvent );
 		if ( localEvent.Consumed )
 			moveEvent.eat();
 	}
@@ -466,10 +688,7 @@ namespace OpenGUI {
 		_translatePointIn( point );
 		Cursor_EventArgs localEvent( point.x, point.y );
 		if ( pressEvent.Consumed ) localEvent.eat();
-		WidgetCollection::iterator i, ie = Children.end();
-		for ( i = Children.begin(); i != ie; i++ ) {
-			i->_injectCursorPress( localEvent );
-		}
+		Children._injectCursorPress( localEvent );
 		if ( localEvent.Consumed )
 			pressEvent.eat();
 	}
@@ -479,14 +698,15 @@ namespace OpenGUI {
 		_translatePointIn( point );
 		Cursor_EventArgs localEvent( point.x, point.y );
 		if ( releaseEvent.Consumed ) localEvent.eat();
-		WidgetCollection::iterator i, ie = Children.end();
-		for ( i = Children.begin(); i != ie; i++ ) {
-			i->_injectCursorRelease( localEvent );
-		}
+		Children._injectCursorRelease( localEvent );
 		if ( localEvent.Consumed )
 			releaseEvent.eat();
 	}
 	//############################################################################
+	bool ContainerControl::_isCursorEngaged() {
+		return Control::_isCursorEngaged() || Children._isCursorEngaged();
+	}
+	//############################################################################
 	void ContainerControl::onCursorMove( Object* sender, Cursor_EventArgs& evtArgs ) {
 		if ( mConsumeInput ) {
 			Control::onCursorMove( sender, evtArgs );
@@ -23,7 +23,14 @@ namespace OpenGUI {
 	also supplies an automatic layout system that will reposition and resize child controls
 	according to their exposed layout preferences. Additionally, the results of draw operations
 	from this object, as well as its children, are cached by this object to provide speed
-	increases.
+	increases. When the cache is kept in memory, the output of each child is kept separately,
+	so invalidating one child only redraws that child rather than the entire container.
+
+	How the output is cached is chosen by the CachePolicy. By default (CacheAuto) the container
+	measures how often, and how much of, its content is invalidated over a window of draws and
+	picks the cheapest storage for it: a render texture for content that rarely changes, memory
+	for content where only a few children change at a time, and no cache at all for content that
+	is mostly redrawn every frame anyway, where recording it would only add to the cost.
 
 	\note
 	If a subclass wishes to restrict the client area (the rect within the container in which
@@ -35,6 +42,7 @@ namespace OpenGUI {
 	\par Properties
 		- Padding: setPadding(), getPadding()
 		- ConsumeInput: setConsumeInput(), getConsumeInput()
+		- CachePolicy: setCachePolicy(), getCachePolicy()
 
 	\par Events Introduced
 		- \ref Event_ChildAttached "ChildAttached"
@@ -60,6 +68,27 @@ namespace OpenGUI {
 		//! retrieves current ConsumeInput setting
 		bool getConsumeInput();
 
+		//! Values used by get/setCachePolicy
+		enum CachePolicy {
+			CacheAuto = 0, //!< Chooses one of the policies below from measured use
+			CacheNone = 1, //!< Draws the content directly every frame
+			CacheMemory = 2, //!< Records the content in memory, re-recording only invalidated children
+			CacheRTT = 3 //!< Renders the content to a render texture, if the Renderer supports them
+		};
+		//! Sets how the output of this container is cached. Default is \c CacheAuto
+		void setCachePolicy( int policy );
+		//! Returns the requested CachePolicy
+		int getCachePolicy();
+		//! Returns the CachePolicy currently in effect, which is never \c CacheAuto
+		int getActiveCachePolicy();
+
+		//! Returns the fraction of draws that found some of the content invalidated, over the last measured window
+		float statsGetCacheChangeRate();
+		//! Returns the average fraction of the content that each draw needed to redraw, over the last measured window
+		float statsGetCacheRedrawFraction();
+		//! Returns the number of render operations the content produced when it was last recorded
+		unsigned int statsGetCacheOperations();
+
 		//! suspends automatic layout updates until resumeLayout() is called
 		void suspendLayout();
 		//! resumes automatic layout updates and performs an immediate layout update if the current layout is out of date
@@ -68,9 +97,16 @@ namespace OpenGUI {
 		bool layoutValid();
 		//! Performs the layout operation for child widgets, marking the new layout as valid.
 		void updateLayout();
-		//! Marks the current layout schema as invalid.
+		//! Marks the current layout schema as invalid, queuing a layout update for the next Screen::update()
 		void invalidateLayout();
 
+		//! \internal Performs any pending layout updates for this container and all of its children
+		void _resolveLayout();
+		//! \internal Called when a child Control's desired size may have changed. Does nothing by default
+		/*! Containers that arrange their children by measurement override this to re-measure
+		themselves and queue a layout update. */
+		virtual void _invalidatedChildMeasure();
+
 		//! \internal In addition to previous functionality, this adds a "DrawBG" operation and calls the children _draw between the foreground and background onDraws
 		virtual void _draw( Brush& brush );
 
@@ -83,6 +119,10 @@ namespace OpenGUI {
 		//Object Functions
 		virtual ObjectAccessorList* getAccessors();
 		virtual unsigned int getObjectType() const;
+		//! Returns \c object as a ContainerControl, or 0 if it is not one. Equivalent to, but much cheaper than, \c dynamic_cast<ContainerControl*>
+		static ContainerControl* _cast( Object* object ) {
+			return object && object->isKindOf( KIND_CONTAINERCONTROL ) ? static_cast<ContainerControl*>( object ) : 0;
+		}
 
 		// reimplementations from Widget
 		virtual void _translatePointIn( FVector2& point );
@@ -93,6 +133,7 @@ namespace OpenGUI {
 		virtual void _sendToChildren_CursorMove( Cursor_EventArgs& moveEvent );
 		virtual void _sendToChildren_CursorPress( Cursor_EventArgs& pressEvent );
 		virtual void _sendToChildren_CursorRelease( Cursor_EventArgs& releaseEvent );
+		virtual bool _isCursorEngaged();
 
 	protected:
 //!\name Event Injectors
@@ -118,7 +159,7 @@ namespace OpenGUI {
 
 		//! Flushes the local Brush output cache that contains operations from this and all child Widgets
 		virtual void onInvalidated( Object* sender, EventArgs& evtArgs );
-		//! Invalidates this widget, which causes a flush of the local cache of child operations
+		//! Invalidates this widget, keeping the local cache of all operations but those of the invalidated child
 		virtual void onInvalidatedChild( Object* sender, EventArgs& evtArgs );
 
 		//! flushes local Brush cache in addition to normal functionality
@@ -158,8 +199,10 @@ namespace OpenGUI {
 		//! \internal reimplementation from Widget. This will return the requested child if it exists, otherwise returns 0
 		Widget* _getChildByName( const String& childName ) const;
 
-		//! \internal redefinition from Widget::_invalidatedChild()
-		virtual void _invalidatedChild();
+		//! \internal redefinition from Widget::_invalidatedChild(). Marks the part of the cache holding the \c child as out of date
+		virtual void _invalidatedChild( Widget* child );
+		//! \internal redefinition from Widget::_isChildCacheDirty(). True if the cache is gone or the \c child's part of it is already out of date
+		virtual bool _isChildCacheDirty( Widget* child ) const;
 
 		//! flushes the local draw cache. Causes a call to invalidate() automatically
 		void dirtyCache();
@@ -173,10 +216,30 @@ namespace OpenGUI {
 		bool m_LayoutSuspended; // state variable: marks if layouts are suspended
 		bool m_LayoutValid; // state variable: holds layout validity
 		bool m_InUpdateLayout; // state variable: true if currently running updateLayout()
+		bool m_ChildLayoutPending; // state variable: true if a child container is waiting for a queued layout
+		bool m_LayoutQueued; // state variable: true while a Screen holds a queued layout update for us
+		void _queueLayout();
+		void onAttached_Layout( Object* sender, Attach_EventArgs& evtArgs );
+		void onDetached_Layout( Object* sender, Attach_EventArgs& evtArgs );
 		Brush_Caching* mCacheBrush;
+		bool m_InChildInvalidation; // state variable: true while invalidating for a child, which only dirties that child's part of the cache
 		void onDetached_BrushCache( Object* sender, Attach_EventArgs& evtArgs );
+		void _drawContent( Brush& brush, Brush_Caching* segments ); // draws background, children, and foreground in local coords
+		void _measureCacheUse(); // accounts for a draw, and chooses a new policy at the end of each window
+
+		int mCachePolicy; // requested policy
+		int mActiveCachePolicy; // policy in effect
+		bool mCacheWholeDirty; // the entire content was invalidated since the last draw
+		unsigned int mCacheDirtyChildren; // number of child invalidations since the last draw
+		unsigned int mCacheDraws; // draws in the current window
+		unsigned int mCacheChangedDraws; // draws in the current window that found something invalidated
+		float mCacheRedrawSum; // sum of the redrawn fraction of each draw in the current window
+		unsigned int mCacheOperations; // render operations recorded by the last full recording
+		float mStatCacheChangeRate; // result of the last complete window
+		float mStatCacheRedrawFraction; // result of the last complete window
 
 		float mPadding; // holds the padding of the container
+		FRect mClientArea; // result of getClientArea(), kept per container as Screens may draw on several threads
 
 		bool mConsumeInput; // holds setting to auto-consume input that occurs within this container
 	};
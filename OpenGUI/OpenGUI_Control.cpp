@@ -8,6 +8,11 @@
 #include "OpenGUI_Macros.h"
 
 namespace OpenGUI {
+	static const EventID Event_Targeted( "Targeted" );
+	static const EventID Event_UnTargeted( "UnTargeted" );
+	static const EventID Event_Moved( "Moved" );
+	static const EventID Event_Resized( "Resized" );
+	//############################################################################
 
 	SimpleProperty_Float( property_Left, "Left", Control, getLeft, setLeft );
 	SimpleProperty_Float( property_Top, "Top", Control, getTop, setTop );
@@ -131,11 +136,13 @@ namespace OpenGUI {
 		~Control_ObjectAccessorList() {}
 	}
 	gControl_ObjectAccessorList;
+	ClassEventList gControl_ClassEventList;
 	//############################################################################
 	//############################################################################
 
 	//############################################################################
 	Control::Control() {
+		_addObjectKind( KIND_CONTROL );
 		if ( gControl_ObjectAccessorList.getParent() == 0 )
 			gControl_ObjectAccessorList.setParent( Widget::getAccessors() );
 
@@ -153,19 +160,20 @@ namespace OpenGUI {
 		mAnchors = Left | Top;
 		mDock = None;
 		mMargin = 0.0f;
+		mDesiredSizeValid = false;
 
 		mClickTrack = false;
 
 		//Set up events and default bindings
-		getEvents().createEvent( "Targeted" );
-		getEvents().createEvent( "UnTargeted" );
-		getEvents()["Targeted"].add( new EventDelegate( this, &Control::onTargeted ) );
-		getEvents()["UnTargeted"].add( new EventDelegate( this, &Control::onUnTargeted ) );
+		if ( gControl_ClassEventList.empty() ) {
+			gControl_ClassEventList.setParent( getEvents().getClassEvents() );
+			gControl_ClassEventList.addEvent( Event_Targeted, &Control::onTargeted );
+			gControl_ClassEventList.addEvent( Event_UnTargeted, &Control::onUnTargeted );
 
-		getEvents().createEvent( "Moved" );
-		getEvents().createEvent( "Resized" );
-		getEvents()["Moved"].add( new EventDelegate( this, &Control::onMoved ) );
-		getEvents()["Resized"].add( new EventDelegate( this, &Control::onResized ) );
+			gControl_ClassEventList.addEvent( Event_Moved, &Control::onMoved );
+			gControl_ClassEventList.addEvent( Event_Resized, &Control::onResized );
+		}
+		getEvents().setClassEvents( &gControl_ClassEventList );
 	}
 	//############################################################################
 	Control::~Control() {
@@ -196,10 +204,17 @@ namespace OpenGUI {
 		return mRect.isInside( position );
 	}
 	//############################################################################
+	bool Control::_getHitBounds( FRect& bounds ) {
+		bounds = mRect;
+		return true;
+	}
+	//############################################################################
 	void Control::setLeft( float left ) {
 		FVector2 oldPos = getPosition();
 		if ( oldPos.x != left ) { // only bother with all this if the value is different
+			_damage(); // the area being left needs to be redrawn, invalidate() below covers the new one
 			mRect.setPosition( FVector2( left, oldPos.y ) );
+			if ( getContainer() ) getContainer()->_notifyChildBoundsChanged( this );
 			eventMoved( oldPos, getPosition() );
 			if ( !m_InLayout ) { // only do this if we are not under control of the container during layouts
 				if ( mDock ) { // if we aren't docking, no one will be depending on us for the layout
@@ -218,7 +233,9 @@ namespace OpenGUI {
 	void Control::setTop( float top ) {
 		FVector2 oldPos = getPosition();
 		if ( oldPos.y != top ) { // only bother with all this if the value is different
+			_damage(); // old area
 			mRect.setPosition( FVector2( oldPos.x, top ) );
+			if ( getContainer() ) getContainer()->_notifyChildBoundsChanged( this );
 			eventMoved( oldPos, getPosition() );
 			if ( !m_InLayout ) { // only do this if we are not under control of the container during layouts
 				if ( mDock ) { // if we aren't docking, no one will be depending on us for the layout
@@ -248,8 +265,11 @@ namespace OpenGUI {
 
 		FVector2 oldSize = getSize();
 		if ( oldSize.x != width ) { // only bother with all this if the value is different
+			_damage(); // old area
 			mRect.setWidth( width );
+			if ( getContainer() ) getContainer()->_notifyChildBoundsChanged( this );
 			eventResized( oldSize, getSize() );
+			invalidateMeasure();
 			if ( !m_InLayout ) { // only do this if we are not under control of the container during layouts
 				if ( mDock ) { // if we aren't docking, no one will be depending on us for the layout
 					if (( mDock & Top ) || ( mDock & Bottom ) ) { // (mDock & Full) is implied
@@ -283,8 +303,11 @@ namespace OpenGUI {
 
 		FVector2 oldSize = getSize();
 		if ( oldSize.y != height ) { // only bother with all this if the value is different
+			_damage(); // old area
 			mRect.setHeight( height );
+			if ( getContainer() ) getContainer()->_notifyChildBoundsChanged( this );
 			eventResized( oldSize, getSize() );
+			invalidateMeasure();
 			if ( !m_InLayout ) { // only do this if we are not under control of the container during layouts
 				if ( mDock ) { // if we aren't docking, no one will be depending on us for the layout
 					if (( mDock & Left ) || ( mDock & Right ) ) { // (mDock & Full) is implied
@@ -375,7 +398,10 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Control::setVisible( bool visible ) {
-		mVisible = visible;
+		if ( mVisible != visible ) {
+			mVisible = visible;
+			invalidateMeasure(); // hidden Controls take no space in measured layouts
+		}
 		invalidate(); // need to invalidate caches for visibility change
 	}
 	//############################################################################
@@ -414,7 +440,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Control::eventTargeted() {
 		EventArgs eventArgs;
-		triggerEvent( "Targeted", eventArgs );
+		triggerEvent( Event_Targeted, eventArgs );
 	}
 	//############################################################################
 	void Control::onUnTargeted( Object* sender, EventArgs& evtArgs ) {
@@ -423,7 +449,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Control::eventUnTargeted() {
 		EventArgs eventArgs;
-		triggerEvent( "UnTargeted", eventArgs );
+		triggerEvent( Event_UnTargeted, eventArgs );
 	}
 	//############################################################################
 	void Control::onCursorEnter( Object* sender, EventArgs& evtArgs ) {
@@ -442,7 +468,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Control::eventMoved( const FVector2& oldPosition, const FVector2& newPosition ) {
 		Moved_EventArgs event( oldPosition, newPosition );
-		triggerEvent( "Moved", event );
+		triggerEvent( Event_Moved, event );
 	}
 	//############################################################################
 	void Control::onResized( Object* sender, Resized_EventArgs& evtArgs ) {
@@ -451,7 +477,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Control::eventResized( const FVector2& oldSize, const FVector2& newSize ) {
 		Resized_EventArgs event( newSize, oldSize );
-		triggerEvent( "Resized", event );
+		triggerEvent( Event_Resized, event );
 	}
 	//############################################################################
 	/*! Docking is a service provided by the container. It
@@ -539,12 +565,37 @@ namespace OpenGUI {
 	//############################################################################
 	void Control::_invalidateLayout() {
 		if ( !m_InLayout ) {
-			ContainerControl* c = dynamic_cast<ContainerControl*>( getParent() );
+			ContainerControl* c = ContainerControl::_cast( getParent() );
 			if ( c )
 				c->invalidateLayout();
 		}
 	}
 	//############################################################################
+	/*! The desired size is measured at most once between invalidations, so containers
+	that arrange by measurement only pay to re-measure the Controls that changed. */
+	const FVector2& Control::getDesiredSize() {
+		if ( !mDesiredSizeValid ) {
+			mDesiredSize = _measure();
+			mDesiredSizeValid = true;
+		}
+		return mDesiredSize;
+	}
+	//############################################################################
+	/*! The container is not notified while it is arranging this Control, as it is
+	the one making the change. */
+	void Control::invalidateMeasure() {
+		mDesiredSizeValid = false;
+		if ( !m_InLayout ) {
+			ContainerControl* c = ContainerControl::_cast( getParent() );
+			if ( c )
+				c->_invalidatedChildMeasure();
+		}
+	}
+	//############################################################################
+	FVector2 Control::_measure() {
+		return getSize();
+	}
+	//############################################################################
 	void Control::_breakDocking() {
 		if ( !m_InLayout )
 			setDocking( None );
@@ -559,6 +610,7 @@ namespace OpenGUI {
 		if ( margin == mMargin ) return;
 		mMargin = margin;
 		_invalidateLayout();
+		invalidateMeasure();
 	}
 	//############################################################################
 	/*! \see See setMargin() for information on margins */
@@ -572,6 +624,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Control::setCursor( CursorPtr cursorPtr ) {
 		m_Cursor = cursorPtr;
+		_damage(); // the Screen cursor may be over us, and would need to change
 	}
 	//############################################################################
 	CursorPtr Control::getCursor() const {
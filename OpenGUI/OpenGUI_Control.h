@@ -78,6 +78,11 @@ namespace OpenGUI {
 		//! Sets the maximum size this Control will allow itself to be resized to
 		void setMaximumSize( const FVector2& size );
 
+		//! Returns the size this Control asks for when arranged by a measuring container, such as StackPanel or GridPanel
+		const FVector2& getDesiredSize();
+		//! Discards the cached desired size, and notifies the container that it will need to be measured again
+		void invalidateMeasure();
+
 		//! Sets the visibility of this Control
 		void setVisible( bool visible );
 		//! Returns the visibility of this Control
@@ -91,6 +96,10 @@ namespace OpenGUI {
 		//Object Functions
 		virtual ObjectAccessorList* getAccessors();
 		virtual unsigned int getObjectType() const;
+		//! Returns \c object as a Control, or 0 if it is not one. Equivalent to, but much cheaper than, \c dynamic_cast<Control*>
+		static Control* _cast( Object* object ) {
+			return object && object->isKindOf( KIND_CONTROL ) ? static_cast<Control*>( object ) : 0;
+		}
 
 		//! Values used by get/setDocking and get/setAnchor
 		enum ControlSides {
@@ -126,6 +135,8 @@ namespace OpenGUI {
 
 		//! Returns true if the given point is inside this Widget
 		virtual bool isInside( const FVector2& position );
+		//! \internal Reports the rect of this Control
+		virtual bool _getHitBounds( FRect& bounds );
 
 	protected:
 //!\name Event Injectors
@@ -168,6 +179,11 @@ namespace OpenGUI {
 		//! Gets the current cursor displayed when the Screen cursor is over this Control
 		CursorPtr getCursor() const;
 
+		//! Calculates the desired size of this Control. The default is the current size.
+		/*! Override this to size a Control from its content, and call invalidateMeasure()
+		whenever that content changes. The result is cached by getDesiredSize(). */
+		virtual FVector2 _measure();
+
 
 	private:
 		// returns a pointer to the first sibling found at the given position
@@ -187,6 +203,8 @@ namespace OpenGUI {
 		int mAnchors; // anchored sides
 		int mDock; // docking preference
 		float mMargin; // layout margin
+		FVector2 mDesiredSize; // cached result of _measure()
+		bool mDesiredSizeValid; // true if mDesiredSize is up to date
 
 		CursorPtr m_Cursor; // the cursor drawn when over this Control
 
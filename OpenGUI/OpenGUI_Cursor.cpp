@@ -5,6 +5,12 @@
 #include "OpenGUI_Cursor.h"
 
 namespace OpenGUI {
+	static const EventID Event_Draw( "Draw" );
+	static const EventID Event_CursorMove( "CursorMove" );
+	static const EventID Event_CursorPress( "CursorPress" );
+	static const EventID Event_CursorRelease( "CursorRelease" );
+	static const EventID Event_CursorHidden( "CursorHidden" );
+	static const EventID Event_CursorShown( "CursorShown" );
 
 	//############################################################################
 	class Cursor_Size_ObjectProperty : public ObjectProperty {
@@ -45,6 +51,7 @@ namespace OpenGUI {
 		~Cursor_ObjectAccessorList() {}
 	}
 	gCursor_ObjectAccessorList;
+	ClassEventList gCursor_ClassEventList;
 	//############################################################################
 	//############################################################################
 
@@ -65,18 +72,15 @@ namespace OpenGUI {
 		mSize = FVector2( 20.0f, 20.0f );
 
 		// set up events
-		getEvents().createEvent( "Draw" );
-		getEvents()["Draw"].add( new EventDelegate( this, &Cursor::onDraw ) );
-		getEvents().createEvent( "CursorMove" );
-		getEvents().createEvent( "CursorPress" );
-		getEvents().createEvent( "CursorRelease" );
-		getEvents().createEvent( "CursorHidden" );
-		getEvents().createEvent( "CursorShown" );
-		getEvents()["CursorMove"].add( new EventDelegate( this, &Cursor::onCursorMove ) );
-		getEvents()["CursorPress"].add( new EventDelegate( this, &Cursor::onCursorPress ) );
-		getEvents()["CursorRelease"].add( new EventDelegate( this, &Cursor::onCursorRelease ) );
-		getEvents()["CursorHidden"].add( new EventDelegate( this, &Cursor::onCursorHidden ) );
-		getEvents()["CursorShown"].add( new EventDelegate( this, &Cursor::onCursorShown ) );
+		if ( gCursor_ClassEventList.empty() ) {
+			gCursor_ClassEventList.addEvent( Event_Draw, &Cursor::onDraw );
+			gCursor_ClassEventList.addEvent( Event_CursorMove, &Cursor::onCursorMove );
+			gCursor_ClassEventList.addEvent( Event_CursorPress, &Cursor::onCursorPress );
+			gCursor_ClassEventList.addEvent( Event_CursorRelease, &Cursor::onCursorRelease );
+			gCursor_ClassEventList.addEvent( Event_CursorHidden, &Cursor::onCursorHidden );
+			gCursor_ClassEventList.addEvent( Event_CursorShown, &Cursor::onCursorShown );
+		}
+		getEvents().setClassEvents( &gCursor_ClassEventList );
 	}
 	//############################################################################
 	Cursor::~Cursor() {
@@ -109,32 +113,32 @@ namespace OpenGUI {
 	//############################################################################
 	void Cursor::eventDraw( float xPos, float yPos, Brush& brush ) {
 		DrawCursor_EventArgs event( xPos, yPos, brush );
-		triggerEvent( "Draw", event );
+		triggerEvent( Event_Draw, event );
 	}
 	//############################################################################
 	void Cursor::eventCursorMove( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorMove", event );
+		triggerEvent( Event_CursorMove, event );
 	}
 	//############################################################################
 	void Cursor::eventCursorPress( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorPress", event );
+		triggerEvent( Event_CursorPress, event );
 	}
 	//############################################################################
 	void Cursor::eventCursorRelease( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorRelease", event );
+		triggerEvent( Event_CursorRelease, event );
 	}
 	//############################################################################
 	void Cursor::eventCursorHidden() {
 		EventArgs event;
-		triggerEvent( "CursorHidden", event );
+		triggerEvent( Event_CursorHidden, event );
 	}
 	//############################################################################
 	void Cursor::eventCursorShown( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorShown", event );
+		triggerEvent( Event_CursorShown, event );
 	}
 	//############################################################################
 }//namespace OpenGUI{
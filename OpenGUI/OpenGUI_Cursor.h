@@ -59,7 +59,7 @@ namespace OpenGUI {
 
 	\see \ref EventList_Control "Cursor Events"
 	*/
-	class OPENGUI_API Cursor: public Object {
+	class OPENGUI_API Cursor: public Object, public RefCounted {
 		friend class Screen; // Screen needs access to the protected input event triggers
 		friend class CursorManager;
 	public:
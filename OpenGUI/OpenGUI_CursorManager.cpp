@@ -147,6 +147,7 @@ namespace OpenGUI {
 		cd.Name = BaseName;
 		cd.Library = BaseLibrary;
 		cd.Properties = propertyList;
+		cd.Handles.clear();
 	}
 	//############################################################################
 	void CursorManager::UndefineCursor( const String& Name ) {
@@ -163,11 +164,16 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "No Cursor defined with given Name: " + Name, __FUNCTION__ );
 		CursorDefinition& cd = iter->second;
 		CursorPtr cursor = CreateRawCursor( cd.Name, cd.Library );
-		ValueList proplist = cd.Properties;
-		while ( proplist.size() > 0 ) {
-			Value val = proplist.pop_front();
+		const size_t propCount = cd.Properties.size();
+		if ( cd.Handles.size() != propCount )
+			cd.Handles.assign( propCount, PropertyHandle() );
+		for ( size_t i = 0; i < propCount; i++ ) {
+			Value val = cd.Properties.get(( unsigned int ) i );
 			if ( val.getName().length() > 0 ) {
-				cursor->setProperty( val.getName(), val );
+				PropertyHandle& handle = cd.Handles[i];
+				if ( !handle.isValid() )
+					handle = cursor->resolveProperty( val.getName() );
+				cursor->setProperty( handle, val );
 			}
 		}
 		cursor->mName = Name;
@@ -73,6 +73,7 @@ namespace OpenGUI {
 			String Name;
 			String Library;
 			ValueList Properties;
+			std::vector<PropertyHandle> Handles; // Properties resolved by index, filled on first creation
 		};
 		typedef std::map<String, CursorDefinition> CursorDefinitionMap;
 		CursorDefinitionMap mCursorDefinitionMap;
@@ -4,50 +4,139 @@
 
 #include "OpenGUI_Event.h"
 #include "OpenGUI_Object.h"
+#include "OpenGUI_EventHandler.h"
 #include "OpenGUI_Exception.h"
+#include "OpenGUI_HashMap.h"
+#include "OpenGUI_Thread.h"
 
 namespace OpenGUI {
+	//############################################################################
+	// The intern table is built on first use rather than as a global, so that EventIDs
+	// held in statics elsewhere can safely be constructed during static initialization.
+	// Names can also be interned and looked up by Screens drawing on other threads, so the
+	// table is locked, and a deque keeps returned names in place as the table grows.
+	struct EventIDTable {
+		EventIDTable() {
+			mNames.push_back( "" ); // index 0 is reserved for invalid EventIDs
+		}
+		typedef HashMap<String, unsigned int> NameIndexMap;
+		NameIndexMap mIndexMap;
+		typedef std::deque<String> NameList;
+		NameList mNames;
+		Mutex mMutex;
+	};
+	static EventIDTable& GetEventIDTable() {
+		static EventIDTable table;
+		return table;
+	}
+	//############################################################################
+	EventID::EventID( const String& name ) {
+		EventIDTable& table = GetEventIDTable();
+		UpdateLock lock( table.mMutex );
+		EventIDTable::NameIndexMap::iterator iter = table.mIndexMap.find( name );
+		if ( iter != table.mIndexMap.end() ) {
+			mIndex = iter->second;
+			return;
+		}
+		mIndex = ( unsigned int ) table.mNames.size();
+		table.mNames.push_back( name );
+		table.mIndexMap[name] = mIndex;
+	}
+	//############################################################################
+	const String& EventID::getName() const {
+		EventIDTable& table = GetEventIDTable();
+		UpdateLock lock( table.mMutex );
+		return table.mNames[mIndex];
+	}
+	//############################################################################
+	EventID EventID::_find( const String& name ) {
+		EventID retval;
+		EventIDTable& table = GetEventIDTable();
+		UpdateLock lock( table.mMutex );
+		EventIDTable::NameIndexMap::iterator iter = table.mIndexMap.find( name );
+		if ( iter != table.mIndexMap.end() )
+			retval.mIndex = iter->second;
+		return retval;
+	}
+	//############################################################################
 	//############################################################################
 	EventReceiver::EventReceiver() {
 		mParent = 0;
+		mClassEvents = 0;
 	}
 	//############################################################################
 	EventReceiver::~EventReceiver() {
-		for ( EventHandlerListMap::iterator iter = mEventHandlerListMap.begin();
-				iter != mEventHandlerListMap.end();
+		for ( EventHandlerListTable::iterator iter = mEventTable.begin();
+				iter != mEventTable.end();
 				iter++ ) {
-			EventHandlerList* evt = iter->second;
+			EventHandlerList* evt = ( *iter );
 			delete evt;
 		}
-		mEventHandlerListMap.clear();
+		mEventTable.clear();
 	}
 	//############################################################################
 	void EventReceiver::sendEvent( const String& name, EventArgs& args ) {
-		EventHandlerList* events = getEventHandlers( name );
+		EventID eventID = EventID::_find( name );
+		if ( !eventID.isValid() ) {
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Event does not exist: " + name, __FUNCTION__ );
+		}
+		sendEvent( eventID, args );
+	}
+	//############################################################################
+	/*! The default handlers defined by the ClassEventList are invoked first,
+	followed by the EventHandler objects bound to this instance. */
+	void EventReceiver::sendEvent( const EventID& eventID, EventArgs& args ) {
+		const unsigned int index = eventID.getIndex();
+		EventHandlerList* events = index < mEventTable.size() ? mEventTable[index] : 0;
+		const ClassEventList::ClassEvent* classEvent = mClassEvents ? mClassEvents->_getEvent( eventID ) : 0;
+		if ( !events && !classEvent ) {
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Event does not exist: " + eventID.getName(), __FUNCTION__ );
+		}
+		if ( classEvent ) {
+			const ClassEventList::ClassEvent::HandlerList& handlers = classEvent->handlers;
+			for ( size_t i = 0; i < handlers.size(); i++ )
+				handlers[i]->invoke( mParent, args );
+		}
 		if ( events ) {
 			events->invoke( mParent, args );
-		} else {
-			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Event does not exist: " + name, __FUNCTION__ );
 		}
 	}
 	//############################################################################
 	void EventReceiver::createEvent( const String& name ) {
-		EventHandlerListMap::iterator iter = mEventHandlerListMap.find( name );
-		if ( mEventHandlerListMap.end() != iter ) {
-			OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Event already exists: " + name, __FUNCTION__ );
+		createEvent( EventID( name ) );
+	}
+	//############################################################################
+	void EventReceiver::createEvent( const EventID& eventID ) {
+		if ( !eventID.isValid() ) {
+			OG_THROW( Exception::ERR_INVALIDPARAMS, "Cannot create an event from an invalid EventID", __FUNCTION__ );
+		}
+		const unsigned int index = eventID.getIndex();
+		if (( index < mEventTable.size() && mEventTable[index] ) || ( mClassEvents && mClassEvents->_getEvent( eventID ) ) ) {
+			OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Event already exists: " + eventID.getName(), __FUNCTION__ );
 		}
-		EventHandlerList* evtList = new EventHandlerList();
-		mEventHandlerListMap[name] = evtList;
+		if ( index >= mEventTable.size() )
+			mEventTable.resize( index + 1, 0 );
+		mEventTable[index] = new EventHandlerList();
 	}
 	//############################################################################
 	/*! Returns 0 (NULL) if the event requested does not exist.
 	\see Too create new events see createEvent()	*/
 	EventHandlerList* EventReceiver::getEventHandlers( const String& name ) {
-		EventHandlerListMap::iterator iter = mEventHandlerListMap.find( name );
-		if ( mEventHandlerListMap.end() != iter ) {
-			return iter->second;
-		}
-		return 0;
+		return getEventHandlers( EventID::_find( name ) );
+	}
+	//############################################################################
+	/*! Returns 0 (NULL) if the event requested does not exist. Events defined by
+	the ClassEventList get their EventHandlerList allocated here, on first request. */
+	EventHandlerList* EventReceiver::getEventHandlers( const EventID& eventID ) {
+		const unsigned int index = eventID.getIndex();
+		if ( index < mEventTable.size() && mEventTable[index] )
+			return mEventTable[index];
+		if ( !eventID.isValid() || !mClassEvents || !mClassEvents->_getEvent( eventID ) )
+			return 0;
+		if ( index >= mEventTable.size() )
+			mEventTable.resize( index + 1, 0 );
+		mEventTable[index] = new EventHandlerList();
+		return mEventTable[index];
 	}
 	//############################################################################
 	EventHandlerList& EventReceiver::operator[]( const String& name ) {
@@ -58,5 +147,12 @@ namespace OpenGUI {
 		return *retobj;
 	}
 	//############################################################################
+	EventHandlerList& EventReceiver::operator[]( const EventID& eventID ) {
+		EventHandlerList* retobj = getEventHandlers( eventID );
+		if ( retobj == 0 ) {
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Event does not exist: " + eventID.getName(), __FUNCTION__ );
+		}
+		return *retobj;
+	}
+	//############################################################################
 }// namespace OpenGUI {
-
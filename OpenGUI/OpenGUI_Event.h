@@ -15,6 +15,7 @@ namespace OpenGUI {
 
 	class Object; //forward declaration
 	class EventHandlerList; //forward declaration
+	class ClassEventList; //forward declaration
 	class WidgetCollection; //forward declaration
 	class Widget; //forward declaration
 
@@ -164,7 +165,49 @@ namespace OpenGUI {
 	};
 
 
+	//! Interned event name, used to look up events without comparing strings
+	/*! Constructing an EventID from a name interns that name in a library wide table,
+	so the name is only hashed once. EventReceiver stores its events in a flat table
+	indexed by EventID, so lookups by EventID are a simple array index. Frequently
+	triggered events should keep their EventID around (usually as a static) rather
+	than construct it from the name on every use.
+
+	A default constructed EventID is invalid, and refers to no event.
+	*/
+	class OPENGUI_API EventID {
+		friend class EventReceiver;
+	public:
+		//! Constructs an invalid EventID
+		EventID(): mIndex( 0 ) {}
+		//! Constructs the EventID for the given event \c name, interning it if needed
+		explicit EventID( const String& name );
+		//! Returns the event name this EventID was interned from
+		const String& getName() const;
+		//! Returns the index of this EventID within the intern table
+		unsigned int getIndex() const {
+			return mIndex;
+		}
+		//! Returns \c true if this EventID refers to an event name
+		bool isValid() const {
+			return mIndex != 0;
+		}
+		bool operator==( const EventID& right ) const {
+			return mIndex == right.mIndex;
+		}
+		bool operator!=( const EventID& right ) const {
+			return mIndex != right.mIndex;
+		}
+	private:
+		// finds an already interned name without interning it, returns an invalid EventID if not found
+		static EventID _find( const String& name );
+		unsigned int mIndex;
+	};
+
 	//! Provides a unified event definition, binding, and relaying service.
+	/*! Events come from two places. Events shared by every instance of a class are defined
+	in the ClassEventList given to setClassEvents(), and events specific to an instance can
+	be added with createEvent(). In both cases the EventHandlerList for an event is only
+	allocated once it is first asked for, usually to bind an EventHandler. */
 	class OPENGUI_API EventReceiver {
 		//Only allow Object to create and destroy us. We're not for random reuse.
 		friend class Object;
@@ -173,18 +216,39 @@ namespace OpenGUI {
 		//EventReceiver (){}
 		//! Adds the given \c name to the list of valid (and bindable) events
 		void createEvent( const String& name );
+		//! Adds the given \c eventID to the list of valid (and bindable) events
+		void createEvent( const EventID& eventID );
 		//! Sends an event of the given \c name to all such bound EventHandler instances
 		void sendEvent( const String& name, EventArgs& args );
+		//! Sends an event of the given \c eventID to all such bound EventHandler instances
+		void sendEvent( const EventID& eventID, EventArgs& args );
 
 		//! Returns the list of EventHandler objects for the event of given \c name
 		EventHandlerList* getEventHandlers( const String& name );
+		//! Returns the list of EventHandler objects for the event of given \c eventID
+		EventHandlerList* getEventHandlers( const EventID& eventID );
 		//! Returns reference to the list of EventHandler objects for the event of given \c name, throws exception if event does not exist
 		EventHandlerList& operator[]( const String& name );
+		//! Returns reference to the list of EventHandler objects for the event of given \c eventID, throws exception if event does not exist
+		EventHandlerList& operator[]( const EventID& eventID );
+
+		//! Sets the ClassEventList that defines the events shared by all instances of the owning Object's class
+		/*! This is called by each constructor in the class hierarchy, so the list of the most derived
+		class that defines one is the one that ends up in use. */
+		void setClassEvents( ClassEventList* classEvents ) {
+			mClassEvents = classEvents;
+		}
+		//! Returns the ClassEventList set by setClassEvents(), or 0 (NULL) if none
+		ClassEventList* getClassEvents() {
+			return mClassEvents;
+		}
 	private:
 		EventReceiver();
 		~EventReceiver();
-		typedef std::map<String, EventHandlerList*> EventHandlerListMap;
-		EventHandlerListMap mEventHandlerListMap;
+		// indexed by EventID::getIndex(), holds 0 for events that were not created here
+		typedef std::vector<EventHandlerList*> EventHandlerListTable;
+		EventHandlerListTable mEventTable;
+		ClassEventList* mClassEvents;
 		Object* mParent;
 	};
 
@@ -8,29 +8,192 @@
 namespace OpenGUI {
 	//############################################################################
 	EventHandlerList::~EventHandlerList() {
-		for ( EventHandlerSet::iterator iter = mEventHandlerSet.begin();
-				iter != mEventHandlerSet.end();
-				iter++ ) {
-			EventHandler* handler = ( *iter );
-			handler->onEventDestruction();
+		for ( size_t i = 0; i < mCount; i++ ) {
+			EventHandler* handler = _at( i );
+			if ( handler )
+				handler->onEventDestruction();
 		}
 	}
 	//############################################################################
+	size_t EventHandlerList::_find( EventHandler* handler ) {
+		for ( size_t i = 0; i < mCount; i++ ) {
+			if ( _at( i ) == handler )
+				return i;
+		}
+		return mCount;
+	}
+	//############################################################################
 	void EventHandlerList::add( EventHandler* handler ) {
-		mEventHandlerSet.insert( handler );
+		if ( !handler || _find( handler ) != mCount )
+			return;
+		if ( mCount < INLINE_HANDLERS )
+			mInline[mCount] = handler;
+		else
+			mOverflow.push_back( handler );
+		mCount++;
 	}
 	//############################################################################
+	/*! During an invocation the slot is only cleared, so that the invocation in
+	progress is not disturbed. The list is compacted once the outermost invocation ends. */
 	void EventHandlerList::remove( EventHandler* handler ) {
-		EventHandlerSet::iterator iter = mEventHandlerSet.find( handler );
-		mEventHandlerSet.erase( iter );
+		if ( !handler ) return;
+		size_t index = _find( handler );
+		if ( index == mCount ) return;
+		if ( mInvokeDepth > 0 ) {
+			_at( index ) = 0;
+			mHasRemoved = true;
+			return;
+		}
+		for ( size_t i = index + 1; i < mCount; i++ )
+			_at( i - 1 ) = _at( i );
+		mCount--;
+		if ( mCount >= INLINE_HANDLERS )
+			mOverflow.pop_back();
+	}
+	//############################################################################
+	void EventHandlerList::_compact() {
+		size_t count = 0;
+		for ( size_t i = 0; i < mCount; i++ ) {
+			EventHandler* handler = _at( i );
+			if ( handler )
+				_at( count++ ) = handler;
+		}
+		mCount = count;
+		mOverflow.resize( mCount > INLINE_HANDLERS ? mCount - INLINE_HANDLERS : 0 );
+		mHasRemoved = false;
 	}
 	//############################################################################
 	void EventHandlerList::invoke( Object* sender, EventArgs& args ) {
-		EventHandlerSet::iterator iter, iterend = mEventHandlerSet.end();
-		for ( iter = mEventHandlerSet.begin(); iter != iterend; iter++ ) {
-			EventHandler* handler = ( *iter );
-			handler->onEvent( sender, args );
+		const size_t count = mCount; // handlers added during the invocation wait for the next one
+		mInvokeDepth++;
+		try {
+			for ( size_t i = 0; i < count; i++ ) {
+				EventHandler* handler = _at( i );
+				if ( handler )
+					handler->onEvent( sender, args );
+			}
+		} catch ( ... ) {
+			if ( --mInvokeDepth == 0 && mHasRemoved ) _compact();
+			throw;
+		}
+		if ( --mInvokeDepth == 0 && mHasRemoved ) _compact();
+	}
+	//############################################################################
+	size_t EventHandlerList::size() const {
+		if ( !mHasRemoved )
+			return mCount;
+		size_t count = 0;
+		for ( size_t i = 0; i < mCount; i++ ) {
+			if (( i < INLINE_HANDLERS ? mInline[i] : mOverflow[i - INLINE_HANDLERS] ) )
+				count++;
+		}
+		return count;
+	}
+	//############################################################################
+	//############################################################################
+	unsigned int ClassEventList::sGeneration = 1;
+	ClassEventList* ClassEventList::sFirstList = 0;
+	//############################################################################
+	ClassEventList::ClassEventList() {
+		mParent = 0;
+		mResolvedGeneration = 0;
+		mNextList = sFirstList;
+		sFirstList = this;
+	}
+	//############################################################################
+	ClassEventList::~ClassEventList() {
+		ClassEventList** link = &sFirstList;
+		while ( *link != this )
+			link = &( *link )->mNextList;
+		*link = mNextList;
+		_clearResolved();
+		for ( DefinitionList::iterator iter = mDefinitions.begin(); iter != mDefinitions.end(); iter++ ) {
+			delete iter->second;
+		}
+		mDefinitions.clear();
+	}
+	//############################################################################
+	void ClassEventList::setParent( ClassEventList* parent ) {
+		mParent = parent;
+		sGeneration++;
+	}
+	//############################################################################
+	ClassEventList* ClassEventList::getParent() {
+		return mParent;
+	}
+	//############################################################################
+	void ClassEventList::_addEvent( const EventID& eventID, ClassEventHandler* handler ) {
+		if ( !eventID.isValid() ) {
+			delete handler;
+			OG_THROW( Exception::ERR_INVALIDPARAMS, "Cannot define an event from an invalid EventID", __FUNCTION__ );
+		}
+		mDefinitions.push_back( DefinitionList::value_type( eventID, handler ) );
+		sGeneration++;
+	}
+	//############################################################################
+	void ClassEventList::_resolveAll() {
+		for ( ClassEventList* list = sFirstList; list; list = list->mNextList ) {
+			if ( list->mResolvedGeneration != sGeneration )
+				list->_resolve();
+		}
+	}
+	//############################################################################
+	void ClassEventList::_clearResolved() {
+		for ( ClassEventTable::iterator iter = mEventTable.begin(); iter != mEventTable.end(); iter++ ) {
+			delete ( *iter );
+		}
+		mEventTable.clear();
+		for ( ClassEventTable::iterator iter = mRetiredEvents.begin(); iter != mRetiredEvents.end(); iter++ ) {
+			delete ( *iter );
+		}
+		mRetiredEvents.clear();
+		mResolvedGeneration = 0;
+	}
+	//############################################################################
+	/*! The parent's events are copied in first, so that inherited default handlers
+	are invoked before the ones added by this class.
+
+	Any list can be altered from within an event handler, such as by constructing the first
+	instance of a class, which leaves every list to be resolved again. So the ClassEvents are
+	rebuilt in place, and never freed before the list is, as a dispatch further up the stack
+	may still be reading one. */
+	void ClassEventList::_resolve() {
+		if ( mParent && mParent->mResolvedGeneration != sGeneration )
+			mParent->_resolve();
+		const size_t parentSize = mParent ? mParent->mEventTable.size() : 0;
+		if ( mEventTable.size() < parentSize )
+			mEventTable.resize( parentSize, 0 );
+		std::vector<bool> defined( mEventTable.size(), false );
+		for ( size_t i = 0; i < mEventTable.size(); i++ ) {
+			const ClassEvent* parentEvent = i < parentSize ? mParent->mEventTable[i] : 0;
+			if ( parentEvent ) {
+				if ( !mEventTable[i] )
+					mEventTable[i] = new ClassEvent;
+				mEventTable[i]->handlers = parentEvent->handlers;
+				defined[i] = true;
+			} else if ( mEventTable[i] ) {
+				mEventTable[i]->handlers.clear();
+			}
+		}
+		for ( DefinitionList::iterator iter = mDefinitions.begin(); iter != mDefinitions.end(); iter++ ) {
+			const unsigned int index = iter->first.getIndex();
+			if ( index >= mEventTable.size() ) {
+				mEventTable.resize( index + 1, 0 );
+				defined.resize( index + 1, false );
+			}
+			if ( !mEventTable[index] )
+				mEventTable[index] = new ClassEvent;
+			if ( iter->second )
+				mEventTable[index]->handlers.push_back( iter->second );
+			defined[index] = true;
+		}
+		for ( size_t i = 0; i < mEventTable.size(); i++ ) {
+			if ( mEventTable[i] && !defined[i] ) {
+				mRetiredEvents.push_back( mEventTable[i] );
+				mEventTable[i] = 0;
+			}
 		}
+		mResolvedGeneration = sGeneration;
 	}
 	//############################################################################
 }// namespace OpenGUI {
@@ -10,6 +10,7 @@
 #include "OpenGUI_Types.h"
 #include "OpenGUI_Exception.h"
 #include "OpenGUI_Event.h"
+#include <typeinfo>
 
 namespace OpenGUI {
 	class Object; //forward declaration
@@ -34,25 +35,177 @@ namespace OpenGUI {
 
 
 	//! Provides event handler multi cast service.
+	/*! Handlers are invoked in the order they were added. Handlers may safely be added
+	or removed from within an invocation. Handlers added during an invocation will not
+	be called until the next one. */
 	class OPENGUI_API EventHandlerList {
 		friend class EventReceiver; //allow access to constructor/destructor
 	public:
-		//! add a new EventHandler to the list
+		//! add a new EventHandler to the list. Adding a handler that is already in the list does nothing.
 		void add( EventHandler* handler );
 		//! remove an EventHandler from the list
 		void remove( EventHandler* handler );
 		//! executes all held EventHandlers with the given parameters
 		void invoke( Object* sender, EventArgs& args );
+		//! returns the number of EventHandlers in the list
+		size_t size() const;
 	private:
 		// Only EventReceiver can create/destroy us
-		EventHandlerList() {
+		EventHandlerList(): mCount( 0 ), mInvokeDepth( 0 ), mHasRemoved( false ) {
 			/**/
 		}
 		virtual ~EventHandlerList();
 
-		typedef std::set<EventHandler*> EventHandlerSet;
-		EventHandlerSet mEventHandlerSet;
-		EventHandlerSet mHandlersToDelete;
+		// Most events have zero or one handler, so the first few are stored inline
+		// and only lists longer than that spill over into mOverflow.
+		enum { INLINE_HANDLERS = 2 };
+		EventHandler*& _at( size_t index ) {
+			return index < INLINE_HANDLERS ? mInline[index] : mOverflow[index - INLINE_HANDLERS];
+		}
+		size_t _find( EventHandler* handler );
+		void _compact();
+
+		EventHandler* mInline[INLINE_HANDLERS];
+		typedef std::vector<EventHandler*> EventHandlerVector;
+		EventHandlerVector mOverflow;
+		size_t mCount; // number of slots in use, including any removed during invoke()
+		unsigned int mInvokeDepth; // nesting depth of invoke() calls
+		bool mHasRemoved; // true if handlers were removed during invoke(), leaving empty slots
+	};
+
+	//! \internal Casts EventArgs to ARGS_TYPE, remembering the last type that passed the check
+	/*! An event is nearly always sent with the same EventArgs type, so after the first
+	successful dynamic_cast this only needs to compare type_info pointers. A mismatch
+	(including the same type seen through another module's type_info) simply falls
+	back to the dynamic_cast.
+
+	Class event handlers are shared by Screens drawing on other threads, so the remembered
+	type is read once and replaced atomically. Any type it holds has passed the check. */
+	template <class ARGS_TYPE>
+	class _EventArgs_caster {
+	public:
+		_EventArgs_caster(): mCheckedType( 0 ) {}
+		ARGS_TYPE* cast( EventArgs& args ) const {
+			const std::type_info* argsType = &typeid( args );
+			if ( argsType == mCheckedType )
+				return static_cast<ARGS_TYPE*>( &args );
+			ARGS_TYPE* retval = dynamic_cast<ARGS_TYPE*>( &args );
+			if ( retval )
+				OPENGUI_ATOMIC_SET_POINTER( mCheckedType, argsType );
+			return retval;
+		}
+	private:
+		mutable const std::type_info* volatile mCheckedType;
+	};
+
+
+	//! \internal Default handler of a class event, shared by every instance of the class
+	class OPENGUI_API ClassEventHandler {
+	public:
+		virtual ~ClassEventHandler() {}
+		//! Invokes the handler on \c sender, which is the instance experiencing the event
+		virtual void invoke( Object* sender, EventArgs& args ) const = 0;
+	};
+
+	//! \internal ClassEventHandler that calls a member function of the instance experiencing the event
+	template <class CLASS, class ARGS_TYPE>
+	class _ClassEvent_memberFunc: public ClassEventHandler {
+	public:
+		typedef void( CLASS::*MEMBER )( Object* sender, ARGS_TYPE& args );
+		_ClassEvent_memberFunc( MEMBER memberPtr ): mMemberPtr( memberPtr ) {}
+		virtual ~_ClassEvent_memberFunc() {}
+		virtual void invoke( Object* sender, EventArgs& args ) const {
+			ARGS_TYPE* args_spec = mCaster.cast( args );
+			if ( !args_spec ) {
+				OG_THROW( Exception::ERR_INVALIDPARAMS, "Bad reference cast in event delegate. Probably failed to upward cast EventArgs to a more specific type.", __FUNCTION__ );
+			}
+			CLASS* classObj = static_cast<CLASS*>( sender );
+			( classObj->*mMemberPtr )( sender, *args_spec );
+		}
+	private:
+		MEMBER mMemberPtr;
+		_EventArgs_caster<ARGS_TYPE> mCaster;
+	};
+
+	//! Static, per class definition of events and their default handlers
+	/*! A ClassEventList holds the events that every instance of a class has, along with
+	the default handlers that the class binds to them. Since this is shared by the whole
+	class, an EventReceiver only needs to allocate an EventHandlerList for an event once
+	an EventHandler is actually bound to it.
+
+	Like ObjectAccessorList, a ClassEventList is chained to the list of its parent class,
+	and inherits all events and default handlers defined there. A class can also add default
+	handlers to events defined by its parent. When an event is sent, the default handlers
+	are invoked first, from the most basic class to the most derived, followed by any
+	EventHandler bound to the instance.
+
+	Classes fill their list the first time their constructor runs, and then make it the
+	active list of the instance via EventReceiver::setClassEvents().
+
+	The flattened tables are rebuilt lazily by _getEvent() after any list changes. Before
+	Screens are drawn on several threads, _resolveAll() rebuilds them all up front, so the
+	threads only ever read them.
+	*/
+	class OPENGUI_API ClassEventList {
+	public:
+		//! constructor
+		ClassEventList();
+		//! destructor
+		~ClassEventList();
+		//! Sets the parent of this ClassEventList
+		void setParent( ClassEventList* parent );
+		//! Retrieves the current parent of this ClassEventList
+		ClassEventList* getParent();
+		//! Returns \c true if no events have been added and no parent has been set
+		bool empty() const {
+			return mParent == 0 && mDefinitions.empty();
+		}
+
+		//! Defines the given event without a default handler
+		void addEvent( const EventID& eventID ) {
+			_addEvent( eventID, 0 );
+		}
+		//! Defines the given event (if needed) and adds the given member function of \c CLASS as a default handler
+		template <class CLASS, class ARGS_TYPE>
+		void addEvent( const EventID& eventID, void( CLASS::*memberFunc )( Object*, ARGS_TYPE& ) ) {
+			_addEvent( eventID, new _ClassEvent_memberFunc<CLASS, ARGS_TYPE>( memberFunc ) );
+		}
+
+		//! \internal Resolved definition of a single event
+		struct ClassEvent {
+			typedef std::vector<ClassEventHandler*> HandlerList;
+			HandlerList handlers; //!< default handlers, in invocation order
+		};
+		//! \internal Brings the tables of every ClassEventList up to date, so that _getEvent() will not alter them
+		static void _resolveAll();
+		//! \internal Returns the event as defined by this class and its parents, or 0 if it is not defined
+		const ClassEvent* _getEvent( const EventID& eventID ) {
+			if ( mResolvedGeneration != sGeneration ) _resolve();
+			const unsigned int index = eventID.getIndex();
+			if ( index < mEventTable.size() )
+				return mEventTable[index];
+			return 0;
+		}
+	private:
+		void _addEvent( const EventID& eventID, ClassEventHandler* handler );
+		void _resolve();
+		void _clearResolved();
+
+		ClassEventList* mParent;
+		// what this class itself added, the handler is 0 for events that were only defined
+		typedef std::vector< std::pair<EventID, ClassEventHandler*> > DefinitionList;
+		DefinitionList mDefinitions;
+		// the flattened result of this list and its parents, indexed by EventID::getIndex()
+		typedef std::vector<ClassEvent*> ClassEventTable;
+		ClassEventTable mEventTable;
+		// events no longer defined after a parent change, kept as a dispatch may still be reading them
+		ClassEventTable mRetiredEvents;
+		unsigned int mResolvedGeneration; // mEventTable is current while this matches sGeneration
+		// Bumped whenever any list is altered, as a change to a parent alters the tables of every list below it
+		static unsigned int sGeneration;
+		// every ClassEventList in existence, for _resolveAll()
+		ClassEventList* mNextList;
+		static ClassEventList* sFirstList;
 	};
 
 
@@ -115,16 +268,16 @@ namespace OpenGUI {
 		}
 		_Event_memberFunc( MEMBER memberPtr, CLASS* class_objPtr ): mMemberPtr( memberPtr ), mClassObject( class_objPtr ) {}
 		virtual void fire( Object* sender, EventArgs& args ) const {
-			try {
-				ARGS_TYPE& args_spec = dynamic_cast<ARGS_TYPE&>( args );
-				( mClassObject->*mMemberPtr )( sender, args_spec );
-			} catch ( std::bad_cast e ) {
+			ARGS_TYPE* args_spec = mCaster.cast( args );
+			if ( !args_spec ) {
 				OG_THROW( Exception::ERR_INVALIDPARAMS, "Bad reference cast in event delegate. Probably failed to upward cast EventArgs to a more specific type.", __FUNCTION__ );
 			}
+			( mClassObject->*mMemberPtr )( sender, *args_spec );
 		}
 	private:
 		CLASS* mClassObject;
 		MEMBER mMemberPtr;
+		_EventArgs_caster<ARGS_TYPE> mCaster;
 	};
 	//////////////////////////////////////////////////////////////////////////
 	//////////////////////////////////////////////////////////////////////////
@@ -41,7 +41,7 @@ namespace OpenGUI {
 
 	\see BrushImagery::drawFace()
 	*/
-	class OPENGUI_API Face {
+	class OPENGUI_API Face: public RefCounted {
 	public:
 		//! Used to dictate the metric of measurement used in Face related objects
 		enum FaceMetric{
@@ -58,7 +58,7 @@ namespace OpenGUI {
 		std::stringstream ss;
 		ss << "__FontAtlas:" << ( unsigned int ) this;
 
-		TexturePtr tex = TextureManager::getSingleton().createTextureFromTextureData( ss.str(), &mTextureData );
+		TexturePtr tex = TextureManager::getSingleton().createTextureFromTextureData( ss.str(), &mTextureData, false ); // we update this texture as glyphs are added, so it must not be shared
 
 		mImageset = ImageryManager::getSingleton().createImagesetFromTexture( tex, ss.str() );
 
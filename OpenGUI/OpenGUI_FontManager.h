@@ -13,6 +13,7 @@
 #include "OpenGUI_FontSet.h"
 #include "OpenGUI_FontGlyph.h"
 #include "OpenGUI_XML.h"
+#include "OpenGUI_Thread.h"
 
 namespace OpenGUI {
 	class Texture;	//forward declaration
@@ -88,6 +89,8 @@ namespace OpenGUI {
 		void* mFTLibrary;
 
 		FontCache* mFontCache;
+		//! \internal Held by FontSet while it uses the FreeType faces or the FontCache when OPENGUI_THREADED_UPDATE is defined
+		Mutex mMutex;
 
 		typedef std::map<String, FontSetPtr> FontSetPtrMap;
 		FontSetPtrMap mFontSetMap;
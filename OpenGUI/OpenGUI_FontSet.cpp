@@ -143,6 +143,7 @@ namespace OpenGUI {
 	//############################################################################
 	//! Returns the line height in pixels for a given pixelSizeY
 	unsigned int FontSet::getLineSpacing( unsigned int pointSize ) {
+		UpdateLock lock( FontManager::getSingleton().mMutex ); // the face size is shared state
 		IVector2 pixelRes;
 		pixelRes.x = pointSize;
 		pixelRes.y = pointSize;
@@ -164,6 +165,7 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	int FontSet::getAscender( unsigned int pointSize ) {
+		UpdateLock lock( FontManager::getSingleton().mMutex ); // the face size is shared state
 		IVector2 pixelRes;
 		pixelRes.x = pointSize;
 		pixelRes.y = pointSize;
@@ -185,6 +187,7 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	int FontSet::getDescender( unsigned int pointSize ) {
+		UpdateLock lock( FontManager::getSingleton().mMutex ); // the face size is shared state
 		IVector2 pixelRes;
 		pixelRes.x = pointSize;
 		pixelRes.y = pointSize;
@@ -206,6 +209,7 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	int FontSet::getMaxAdvance( unsigned int pointSize ) {
+		UpdateLock lock( FontManager::getSingleton().mMutex ); // the face size is shared state
 		IVector2 pixelRes;
 		pixelRes.x = pointSize;
 		pixelRes.y = pointSize;
@@ -245,6 +249,7 @@ namespace OpenGUI {
 			return false;
 		}
 
+		UpdateLock lock( FontManager::getSingletonPtr()->mMutex );
 		FontManager::getSingletonPtr()->mFontCache
 		->GetGlyph( this, glyph_charCode, pixelSize, outFontGlyph );
 
@@ -240,6 +240,7 @@ namespace OpenGUI {
 		mLibrary = copy.mLibrary;
 		mByWidgetDef = copy.mByWidgetDef;
 		mProperties = copy.mProperties;
+		mHandles = copy.mHandles;
 		typedef std::list<FormEntry*> FormEntryList;
 		for ( FormEntryList::const_iterator iter = copy.mChildren.begin(); iter != copy.mChildren.end();iter++ ) {
 			FormEntry* child = ( *iter );
@@ -264,12 +265,16 @@ namespace OpenGUI {
 
 		try {
 			// process stored properties
-			ValueList propList = mProperties;
-			while ( propList.size() > 0 ) {
-				Value val = propList.pop_front();
-				String name = val.getName();
-				if ( name.length() > 0 ) {
-					widget->setProperty( name, val );
+			const size_t propCount = mProperties.size();
+			if ( mHandles.size() != propCount )
+				mHandles.assign( propCount, PropertyHandle() );
+			for ( size_t i = 0; i < propCount; i++ ) {
+				Value val = mProperties.get(( unsigned int ) i );
+				if ( val.getName().length() > 0 ) {
+					PropertyHandle& handle = mHandles[i];
+					if ( !handle.isValid() )
+						handle = widget->resolveProperty( val.getName() );
+					widget->setProperty( handle, val );
 				}
 			}
 
@@ -277,7 +282,7 @@ namespace OpenGUI {
 
 			//if we're supposed to have children, this is where we create and attach them
 			if ( mChildren.size() > 0 ) {
-				ContainerControl* container = dynamic_cast<ContainerControl*>( widget );
+				ContainerControl* container = ContainerControl::_cast( widget );
 				if ( !container )
 					OG_THROW( Exception::OP_FAILED, "Failed to cast widget into a container, as required to bare children", __FUNCTION__ );
 				else {
@@ -11,6 +11,7 @@
 #include "OpenGUI_Singleton.h"
 #include "OpenGUI_Types.h"
 #include "OpenGUI_Value.h"
+#include "OpenGUI_Object.h"
 #include "OpenGUI_XML.h"
 
 namespace OpenGUI {
@@ -47,6 +48,7 @@ namespace OpenGUI {
 		String mLibrary;
 		bool mByWidgetDef;
 		ValueList mProperties;
+		std::vector<PropertyHandle> mHandles; // mProperties resolved by index, filled by the first buildTree()
 		typedef std::list<FormEntry*> FormEntryList;
 		FormEntryList mChildren;
 	};
@@ -0,0 +1,154 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#include "OpenGUI_GridPanel.h"
+#include "OpenGUI_Macros.h"
+
+namespace OpenGUI {
+	//############################################################################
+
+	SimpleProperty_Integer( property_Columns, "Columns", GridPanel, getColumns, setColumns );
+	SimpleProperty_Float( property_GridSpacing, "Spacing", GridPanel, getSpacing, setSpacing );
+
+	//############################################################################
+	class GridPanel_ObjectAccessorList : public ObjectAccessorList {
+	public:
+		GridPanel_ObjectAccessorList() {
+			addAccessor( &property_Columns );
+			addAccessor( &property_GridSpacing );
+		}
+		~GridPanel_ObjectAccessorList() {}
+	}
+	gGridPanel_ObjectAccessorList;
+
+	//############################################################################
+	//############################################################################
+
+
+	//############################################################################
+	GridPanel::GridPanel() {
+		if ( gGridPanel_ObjectAccessorList.getParent() == 0 )
+			gGridPanel_ObjectAccessorList.setParent( ContainerControl::getAccessors() );
+
+		mColumns = 1;
+		mSpacing = 0.0f;
+	}
+	//############################################################################
+	GridPanel::~GridPanel() {
+		/**/
+	}
+	//############################################################################
+	ObjectAccessorList* GridPanel::getAccessors() {
+		return &gGridPanel_ObjectAccessorList;
+	}
+	//############################################################################
+	unsigned int GridPanel::getObjectType() const {
+		return OT_GRIDPANEL;
+	}
+	//############################################################################
+	/*! Values less than 1 are clamped to 1 */
+	void GridPanel::setColumns( int columns ) {
+		if ( columns < 1 ) columns = 1;
+		if ( mColumns == columns ) return;
+		mColumns = columns;
+		_invalidatedChildMeasure();
+	}
+	//############################################################################
+	int GridPanel::getColumns() {
+		return mColumns;
+	}
+	//############################################################################
+	/*! Negative values are clamped to 0.0f */
+	void GridPanel::setSpacing( float spacing ) {
+		if ( spacing < 0.0f ) spacing = 0.0f;
+		if ( mSpacing == spacing ) return;
+		mSpacing = spacing;
+		_invalidatedChildMeasure();
+	}
+	//############################################################################
+	float GridPanel::getSpacing() {
+		return mSpacing;
+	}
+	//############################################################################
+	void GridPanel::_invalidatedChildMeasure() {
+		invalidateMeasure();
+		invalidateLayout();
+	}
+	//############################################################################
+	FVector2 GridPanel::_measure() {
+		FVector2 used = _measureCells();
+		float padding = getPadding();
+		return FVector2( used.x + padding * 2.0f + m_ClientAreaOffset_UL.x - m_ClientAreaOffset_LR.x,
+						 used.y + padding * 2.0f + m_ClientAreaOffset_UL.y - m_ClientAreaOffset_LR.y );
+	}
+	//############################################################################
+	/*! Fills mColumnWidths and mRowHeights from the desired sizes of the visible
+	children, and returns the size of the whole grid. */
+	FVector2 GridPanel::_measureCells() {
+		mColumnWidths.assign( mColumns, 0.0f );
+		mRowHeights.clear();
+
+		int cell = 0;
+		WidgetCollection::iterator iter, iterend = Children.end();
+		for ( iter = Children.begin(); iter != iterend; iter++ ) {
+			Control* ctrl = Control::_cast( iter.get() );
+			if ( !ctrl || !ctrl->getVisible() )
+				continue;
+			const FVector2& size = ctrl->getDesiredSize();
+			float margin = ctrl->getMargin();
+			int column = cell % mColumns;
+			if ( column == 0 )
+				mRowHeights.push_back( 0.0f );
+			float& width = mColumnWidths[column];
+			float& height = mRowHeights.back();
+			if ( size.x + margin * 2.0f > width ) width = size.x + margin * 2.0f;
+			if ( size.y + margin * 2.0f > height ) height = size.y + margin * 2.0f;
+			cell++;
+		}
+
+		FVector2 used( 0.0f, 0.0f );
+		for ( FloatVector::iterator i = mColumnWidths.begin(); i != mColumnWidths.end(); i++ )
+			used.x += ( *i );
+		for ( FloatVector::iterator i = mRowHeights.begin(); i != mRowHeights.end(); i++ )
+			used.y += ( *i );
+		if ( !mRowHeights.empty() ) {
+			int usedColumns = cell < mColumns ? cell : mColumns;
+			used.x += mSpacing * ( float )( usedColumns - 1 );
+			used.y += mSpacing * ( float )( mRowHeights.size() - 1 );
+		}
+		return used;
+	}
+	//############################################################################
+	void GridPanel::_doUpdateLayout() {
+		_measureCells();
+
+		FRect area = getClientArea();
+		float padding = getPadding();
+		FVector2 pos( area.min.x + padding, area.min.y + padding );
+		float left = pos.x;
+
+		int cell = 0;
+		WidgetCollection::iterator iter, iterend = Children.end();
+		for ( iter = Children.begin(); iter != iterend; iter++ ) {
+			Control* ctrl = Control::_cast( iter.get() );
+			if ( !ctrl || !ctrl->getVisible() )
+				continue;
+			int column = cell % mColumns;
+			int row = cell / mColumns;
+			if ( column == 0 && row > 0 ) {
+				pos.x = left;
+				pos.y += mRowHeights[row - 1] + mSpacing;
+			}
+			FVector2 size = ctrl->getDesiredSize();
+			float margin = ctrl->getMargin();
+			ctrl->setLeft( pos.x + margin );
+			ctrl->setTop( pos.y + margin );
+			ctrl->setWidth( size.x );
+			ctrl->setHeight( size.y );
+			pos.x += mColumnWidths[column] + mSpacing;
+			cell++;
+		}
+	}
+	//############################################################################
+} // namespace OpenGUI {
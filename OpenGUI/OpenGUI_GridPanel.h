@@ -0,0 +1,72 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#ifndef FA12E1BC_19C2_4CA0_915B_21CB26F2AB1A
+#define FA12E1BC_19C2_4CA0_915B_21CB26F2AB1A
+
+#include "OpenGUI_PreRequisites.h"
+#include "OpenGUI_Exports.h"
+#include "OpenGUI_Types.h"
+#include "OpenGUI_ContainerControl.h"
+
+namespace OpenGUI {
+
+	//! ContainerControl that places its children into the cells of a grid
+	/*! Children fill the grid in collection order, left to right and then top to
+	bottom, one child per cell. Each column is as wide as the widest desired size
+	(see Control::getDesiredSize()) within it, and each row as tall as the tallest,
+	with margins included. Children keep their desired size and are placed in the
+	upper left of their cell. Hidden children take no cell.
+
+	Like StackPanel, the desired sizes of the children are cached, so changing one
+	child only re-measures that child. The desired size of a GridPanel is the area
+	of the whole grid.
+
+	\par Properties
+	- Columns: setColumns(), getColumns()
+	- Spacing: setSpacing(), getSpacing()
+	*/
+	class OPENGUI_API GridPanel : public ContainerControl {
+	public:
+		//! public constructor
+		GridPanel();
+		//! public destructor
+		virtual ~GridPanel();
+
+		//! Sets the number of columns in the grid. Default is 1
+		void setColumns( int columns );
+		//! Returns the number of columns in the grid
+		int getColumns();
+
+		//! Sets the space left between neighboring rows and columns
+		void setSpacing( float spacing );
+		//! Returns the space left between neighboring rows and columns
+		float getSpacing();
+
+		//Object Functions
+		virtual ObjectAccessorList* getAccessors();
+		virtual unsigned int getObjectType() const;
+
+		//! \internal re-measures this container and queues a layout update
+		virtual void _invalidatedChildMeasure();
+
+	protected:
+		//! Returns the space needed by the grid
+		virtual FVector2 _measure();
+		//! Positions the children
+		virtual void _doUpdateLayout();
+
+	private:
+		FVector2 _measureCells();
+
+		int mColumns;
+		float mSpacing;
+		typedef std::vector<float> FloatVector;
+		FloatVector mColumnWidths; // filled by _measureCells()
+		FloatVector mRowHeights; // filled by _measureCells()
+	};
+
+} // namespace OpenGUI{
+
+#endif // FA12E1BC_19C2_4CA0_915B_21CB26F2AB1A
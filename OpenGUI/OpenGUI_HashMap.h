@@ -0,0 +1,269 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#ifndef E9A82E5C_C6F7_4fd2_B58C_A34454BF2248
+#define E9A82E5C_C6F7_4fd2_B58C_A34454BF2248
+
+#include "OpenGUI_PreRequisites.h"
+#include "OpenGUI_String.h"
+
+namespace OpenGUI {
+
+	//!\internal Default hash functor, suitable for integral and pointer keys
+	template<typename KEY>
+	struct HashFunc {
+		size_t operator()( const KEY& key ) const {
+			size_t h = ( size_t ) key;
+			return h ^ ( h >> 4 ); // pointers are aligned, so fold the high bits into the low ones
+		}
+	};
+
+	//!\internal Hash functor for String keys (FNV-1a over the code points)
+	template<>
+	struct HashFunc<String> {
+		size_t operator()( const String& key ) const {
+			const String::code_point* data = key.data();
+			const size_t len = key.size();
+			size_t h = 2166136261U;
+			for ( size_t i = 0; i < len; i++ ) {
+				h ^= ( size_t ) data[i];
+				h *= 16777619U;
+			}
+			return h;
+		}
+	};
+
+	//!\internal Chained hash table with a std::map like interface
+	/*! This exists purely to get lookups off of the linear list scans and
+		std::map compares that used to sit in the hot paths. Only the subset of
+		the std::map interface that is actually used within the library is provided.
+		Iteration order is undefined, so anything that needs a stable order must
+		keep its own list or sort the results.
+
+		Iterators are invalidated by any insertion that causes the table to grow,
+		and by erasure of the element they point to.
+	*/
+	template < typename KEY, typename VALUE, typename HASH = HashFunc<KEY> >
+	class HashMap {
+	public:
+		typedef KEY key_type;
+		typedef VALUE mapped_type;
+		typedef std::pair<const KEY, VALUE> value_type;
+
+	private:
+		struct Node {
+			Node( const KEY& key, const VALUE& value, size_t hash ): entry( key, value ), hashVal( hash ), next( 0 ) {}
+			value_type entry;
+			size_t hashVal;
+			Node* next;
+		};
+		typedef std::vector<Node*> BucketArray;
+
+	public:
+		//!\internal forward iterator, shared by the const and non-const flavors
+		template<typename VT>
+		class Iter {
+			friend class HashMap;
+		public:
+			Iter(): mBuckets( 0 ), mBucket( 0 ), mNode( 0 ) {}
+			template<typename OVT>
+			Iter( const Iter<OVT>& other ): mBuckets( other.mBuckets ), mBucket( other.mBucket ), mNode( other.mNode ) {}
+			VT& operator*() const {
+				return mNode->entry;
+			}
+			VT* operator->() const {
+				return &( mNode->entry );
+			}
+			Iter& operator++() {
+				_advance();
+				return *this;
+			}
+			Iter operator++( int ) {
+				Iter tmp = *this;
+				_advance();
+				return tmp;
+			}
+			bool operator==( const Iter& other ) const {
+				return mNode == other.mNode;
+			}
+			bool operator!=( const Iter& other ) const {
+				return mNode != other.mNode;
+			}
+			// public only so the converting constructor can reach across instantiations
+			const BucketArray* mBuckets;
+			size_t mBucket;
+			Node* mNode;
+		private:
+			Iter( const BucketArray* buckets, size_t bucket, Node* node ): mBuckets( buckets ), mBucket( bucket ), mNode( node ) {}
+			void _advance() {
+				mNode = mNode->next;
+				while ( !mNode && ++mBucket < mBuckets->size() )
+					mNode = ( *mBuckets )[mBucket];
+			}
+		};
+		typedef Iter<value_type> iterator;
+		typedef Iter<const value_type> const_iterator;
+
+		HashMap(): mSize( 0 ) {}
+		HashMap( const HashMap& other ): mSize( 0 ) {
+			_copy( other );
+		}
+		~HashMap() {
+			clear();
+		}
+		HashMap& operator=( const HashMap& other ) {
+			if ( this != &other ) {
+				clear();
+				_copy( other );
+			}
+			return *this;
+		}
+
+		iterator begin() {
+			return iterator( &mBuckets, _firstBucket(), _firstNode() );
+		}
+		iterator end() {
+			return iterator( &mBuckets, mBuckets.size(), 0 );
+		}
+		const_iterator begin() const {
+			return const_iterator( &mBuckets, _firstBucket(), _firstNode() );
+		}
+		const_iterator end() const {
+			return const_iterator( &mBuckets, mBuckets.size(), 0 );
+		}
+
+		size_t size() const {
+			return mSize;
+		}
+		bool empty() const {
+			return mSize == 0;
+		}
+
+		iterator find( const KEY& key ) {
+			if ( mSize == 0 ) return end();
+			const size_t h = mHasher( key );
+			const size_t b = h & ( mBuckets.size() - 1 );
+			for ( Node* n = mBuckets[b]; n; n = n->next ) {
+				if ( n->hashVal == h && n->entry.first == key )
+					return iterator( &mBuckets, b, n );
+			}
+			return end();
+		}
+		const_iterator find( const KEY& key ) const {
+			if ( mSize == 0 ) return end();
+			const size_t h = mHasher( key );
+			const size_t b = h & ( mBuckets.size() - 1 );
+			for ( Node* n = mBuckets[b]; n; n = n->next ) {
+				if ( n->hashVal == h && n->entry.first == key )
+					return const_iterator( &mBuckets, b, n );
+			}
+			return end();
+		}
+
+		//! Returns the value stored under \c key, inserting a default constructed one if needed
+		VALUE& operator[]( const KEY& key ) {
+			iterator iter = find( key );
+			if ( iter != end() )
+				return iter->second;
+			return _insert( key, VALUE() )->entry.second;
+		}
+
+		//! Inserts the given pair if the key is not already present. Returns the iterator to the stored entry, and \c true if it was inserted.
+		std::pair<iterator, bool> insert( const value_type& val ) {
+			iterator iter = find( val.first );
+			if ( iter != end() )
+				return std::pair<iterator, bool>( iter, false );
+			_insert( val.first, val.second );
+			return std::pair<iterator, bool>( find( val.first ), true );
+		}
+
+		//! Removes the entry stored under \c key, returning the number of entries removed (0 or 1)
+		size_t erase( const KEY& key ) {
+			if ( mSize == 0 ) return 0;
+			const size_t h = mHasher( key );
+			Node** link = &mBuckets[h & ( mBuckets.size() - 1 )];
+			while ( *link ) {
+				Node* n = *link;
+				if ( n->hashVal == h && n->entry.first == key ) {
+					*link = n->next;
+					delete n;
+					mSize--;
+					return 1;
+				}
+				link = &n->next;
+			}
+			return 0;
+		}
+		//! Removes the entry referenced by \c iter
+		void erase( iterator iter ) {
+			Node** link = &mBuckets[iter.mBucket];
+			while ( *link != iter.mNode )
+				link = &( *link )->next;
+			*link = iter.mNode->next;
+			delete iter.mNode;
+			mSize--;
+		}
+
+		void clear() {
+			for ( size_t i = 0; i < mBuckets.size(); i++ ) {
+				Node* n = mBuckets[i];
+				while ( n ) {
+					Node* next = n->next;
+					delete n;
+					n = next;
+				}
+			}
+			mBuckets.clear();
+			mSize = 0;
+		}
+
+	private:
+		size_t _firstBucket() const {
+			for ( size_t i = 0; i < mBuckets.size(); i++ )
+				if ( mBuckets[i] ) return i;
+			return mBuckets.size();
+		}
+		Node* _firstNode() const {
+			const size_t b = _firstBucket();
+			return b < mBuckets.size() ? mBuckets[b] : 0;
+		}
+		Node* _insert( const KEY& key, const VALUE& value ) {
+			if ( mSize >= mBuckets.size() )
+				_rehash( mBuckets.empty() ? 16 : mBuckets.size() * 2 );
+			const size_t h = mHasher( key );
+			Node*& head = mBuckets[h & ( mBuckets.size() - 1 )];
+			Node* n = new Node( key, value, h );
+			n->next = head;
+			head = n;
+			mSize++;
+			return n;
+		}
+		// bucket counts are always a power of 2 so we can mask instead of divide
+		void _rehash( size_t bucketCount ) {
+			BucketArray newBuckets( bucketCount, ( Node* )0 );
+			for ( size_t i = 0; i < mBuckets.size(); i++ ) {
+				Node* n = mBuckets[i];
+				while ( n ) {
+					Node* next = n->next;
+					Node*& head = newBuckets[n->hashVal & ( bucketCount - 1 )];
+					n->next = head;
+					head = n;
+					n = next;
+				}
+			}
+			mBuckets.swap( newBuckets );
+		}
+		void _copy( const HashMap& other ) {
+			for ( const_iterator iter = other.begin(); iter != other.end(); ++iter )
+				_insert( iter->first, iter->second );
+		}
+
+		BucketArray mBuckets;
+		size_t mSize;
+		HASH mHasher;
+	};
+
+}//namespace OpenGUI{
+
+#endif // E9A82E5C_C6F7_4fd2_B58C_A34454BF2248
@@ -16,8 +16,7 @@ namespace OpenGUI {
 	class Texture; //forward declaration
 
 	//! Defines a sub area of an Imageset.
-	class OPENGUI_API Imagery {
-		friend class __RefObj<Imagery>; //required for RefPtr to have access to destroy these objects
+	class OPENGUI_API Imagery: public RefCounted {
 		friend class Imageset;
 	public:
 		//! Returns the FRect that defines the Texture UVs for this Imagery within the Imageset
@@ -59,7 +59,7 @@ namespace OpenGUI {
 			return 0;
 		}
 
-		mImagesetList.push_back( imgset );
+		_addImageset( imgset );
 		return imgset;
 	}
 	//############################################################################
@@ -95,30 +95,22 @@ namespace OpenGUI {
 			return 0;
 		}
 
-		mImagesetList.push_back( imgset );
+		_addImageset( imgset );
 		return imgset;
 	}
 	//############################################################################
 	ImagesetPtr ImageryManager::getImagesetByTexture( TexturePtr texture ) {
-		ImagesetPtrList::iterator iter = mImagesetList.begin();
-		while ( iter != mImagesetList.end() ) {
-			if (( *iter )->getTexture() == texture ) {
-				return ( *iter );
-			}
-			iter++;
-		}
+		ImagesetTextureMap::iterator iter = mImagesetTextureMap.find( texture.get() );
+		if ( iter != mImagesetTextureMap.end() )
+			return iter->second;
 		return 0;
 	}
 
 	//############################################################################
 	ImagesetPtr ImageryManager::getImageset( const String& imageFilename ) {
-		ImagesetPtrList::iterator iter = mImagesetList.begin();
-		while ( iter != mImagesetList.end() ) {
-			if (( *iter )->getName() == imageFilename ) {
-				return ( *iter );
-			}
-			iter++;
-		}
+		ImagesetNameMap::iterator iter = mImagesetNameMap.find( imageFilename );
+		if ( iter != mImagesetNameMap.end() )
+			return iter->second;
 		return 0;
 	}
 	//############################################################################
@@ -127,6 +119,7 @@ namespace OpenGUI {
 		while ( iter != mImagesetList.end() ) {
 			if (( *iter ) == pImageset ) {
 				LogManager::SlogMsg( "ImageryManager", OGLL_INFO2 ) << "DestroyImageset: " << pImageset->getName() << Log::endlog;
+				_removeImageset( pImageset.get() );
 				mImagesetList.erase( iter );
 				return;
 			}
@@ -144,21 +137,63 @@ namespace OpenGUI {
 	//############################################################################
 	void ImageryManager::destroyAllImagesets() {
 		LogManager::SlogMsg( "ImageryManager", OGLL_INFO2 ) << "DestroyAllImagesets..." << Log::endlog;
-		ImagesetPtrList::iterator iter = mImagesetList.begin();
+		mImageryFQNMap.clear();
+		mImagesetTextureMap.clear();
+		mImagesetNameMap.clear();
 		mImagesetList.clear();
 	}
 	//############################################################################
+	void ImageryManager::_addImageset( ImagesetPtr imgset ) {
+		mImagesetList.push_back( imgset );
+		Imageset* set = imgset.get();
+		mImagesetNameMap[set->getName()] = set;
+		Texture* tex = set->getTexture().get();
+		if ( mImagesetTextureMap.find( tex ) == mImagesetTextureMap.end() )
+			mImagesetTextureMap[tex] = set;
+	}
+	//############################################################################
+	void ImageryManager::_removeImageset( Imageset* imgset ) {
+		for ( Imageset::ImageryPtrMap::iterator iter = imgset->mChildImageryMap.begin(); imgset->mChildImageryMap.end() != iter; iter++ )
+			_unregisterImagery( iter->second );
+		ImagesetNameMap::iterator nameIter = mImagesetNameMap.find( imgset->getName() );
+		if ( nameIter != mImagesetNameMap.end() && nameIter->second == imgset ) // unless a later Imageset took over the name
+			mImagesetNameMap.erase( nameIter );
+
+		Texture* tex = imgset->getTexture().get();
+		ImagesetTextureMap::iterator texIter = mImagesetTextureMap.find( tex );
+		if ( texIter != mImagesetTextureMap.end() && texIter->second == imgset ) {
+			mImagesetTextureMap.erase( texIter );
+			// another Imageset may share this texture, so hand the slot down to the next one in line
+			for ( ImagesetPtrList::iterator iter = mImagesetList.begin(); iter != mImagesetList.end(); iter++ ) {
+				Imageset* other = ( *iter ).get();
+				if ( other != imgset && other->getTexture().get() == tex ) {
+					mImagesetTextureMap[tex] = other;
+					break;
+				}
+			}
+		}
+	}
+	//############################################################################
+	void ImageryManager::_registerImagery( Imageset* imgset, const ImageryPtr& imagery ) {
+		ImagesetNameMap::iterator iter = mImagesetNameMap.find( imgset->getName() );
+		if ( iter == mImagesetNameMap.end() || iter->second != imgset )
+			return; // Imagesets that have been removed from the manager are no longer searchable
+		mImageryFQNMap[imagery->getFQN()] = imagery;
+	}
+	//############################################################################
+	void ImageryManager::_unregisterImagery( const ImageryPtr& imagery ) {
+		ImageryFQNMap::iterator iter = mImageryFQNMap.find( imagery->getFQN() );
+		if ( iter != mImageryFQNMap.end() && iter->second == imagery )
+			mImageryFQNMap.erase( iter );
+	}
+	//############################################################################
 	ImageryPtr ImageryManager::getImagery( const String& imageryName ) {
 		// test for fully qualified name lookups
-		size_t splitLoc = imageryName.find( ':' );
-		if ( splitLoc != String::npos ) {
+		if ( imageryName.find( ':' ) != String::npos ) {
 			// yep, we can do a FQN lookup, so let's do it
-			const String setName = imageryName.substr( 0, splitLoc );
-			const String imgName = imageryName.substr( splitLoc + 1 );
-			ImagesetPtr imgSet = getImageset( setName );
-			if ( imgSet ) {
-				return imgSet->getImagery( imgName );
-			}
+			ImageryFQNMap::iterator iter = mImageryFQNMap.find( imageryName );
+			if ( iter != mImageryFQNMap.end() )
+				return iter->second;
 			return ImageryPtr( 0 ); // these aren't the droids you're looking for
 		}
 
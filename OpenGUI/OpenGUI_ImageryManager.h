@@ -13,6 +13,7 @@
 #include "OpenGUI_Face.h"
 #include "OpenGUI_XML.h"
 #include "OpenGUI_StrConv.h"
+#include "OpenGUI_HashMap.h"
 
 namespace OpenGUI {
 
@@ -106,6 +107,9 @@ namespace OpenGUI {
 		you are searching for has a globally unique name, otherwise you may not get the Imagery you were
 		intending.
 
+		Fully qualified names are resolved through a single hash lookup, so it is perfectly fine
+		to hold on to "set:name" strings and resolve them on demand.
+
 		\returns ImageryPtr(0) on failure, otherwise a RefPtr to the found Imagery */
 		ImageryPtr getImagery( const String& imageryName );
 
@@ -125,7 +129,19 @@ namespace OpenGUI {
 		StringList getFaceList();
 
 	private:
-		ImagesetPtrList mImagesetList;
+		ImagesetPtrList mImagesetList; // creation order, and ownership of the Imagesets
+		typedef HashMap<String, Imageset*> ImagesetNameMap;
+		ImagesetNameMap mImagesetNameMap; // Imageset name -> Imageset
+		typedef HashMap<Texture*, Imageset*> ImagesetTextureMap;
+		ImagesetTextureMap mImagesetTextureMap; // Texture -> first Imageset created from it
+		typedef HashMap<String, ImageryPtr> ImageryFQNMap;
+		ImageryFQNMap mImageryFQNMap; // "set:name" -> Imagery, for every Imagery of every managed Imageset
+
+		void _addImageset( ImagesetPtr imgset );
+		void _removeImageset( Imageset* imgset );
+		// called by Imagesets as their Imagery is created and destroyed
+		void _registerImagery( Imageset* imgset, const ImageryPtr& imagery );
+		void _unregisterImagery( const ImageryPtr& imagery ); // only forgets the entry if it is still this Imagery
 		static String _generateRandomName();//Generates unique names for Imagesets/Imagery
 		ResourceProvider* mResourceProvider;
 
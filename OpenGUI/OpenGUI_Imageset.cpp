@@ -27,7 +27,7 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	size_t Imageset::getImageryCount() const {
-		return mChildImageryList.size();
+		return mChildImageryMap.size();
 	}
 	//############################################################################
 	ImageryPtr Imageset::createImagery( String imageryName ) {
@@ -59,7 +59,10 @@ namespace OpenGUI {
 		}
 
 		ImageryPtr imgptr = new Imagery( mFilename, imageryName, areaRect, imagesetRect, mpTexture );
-		mChildImageryList.push_back( imgptr );
+		mChildImageryMap[imageryName] = imgptr;
+		ImageryManager* imgMgr = ImageryManager::getSingletonPtr();
+		if ( imgMgr )
+			imgMgr->_registerImagery( this, imgptr );
 		return imgptr;
 	}
 	//############################################################################
@@ -82,13 +85,13 @@ namespace OpenGUI {
 		LogManager::SlogMsg( "Imageset", OGLL_INFO2 ) << "(" << mFilename << ") "
 		<< "Destroying Imagery: " << pImagery->getName() << Log::endlog;
 
-		ImageryPtrList::iterator iter = mChildImageryList.begin();
-		while ( mChildImageryList.end() != iter ) {
-			if (( *iter ) == pImagery ) {
-				mChildImageryList.erase( iter );
-				return;
-			}
-			iter++;
+		ImageryPtrMap::iterator iter = mChildImageryMap.find( pImagery->mName );
+		if ( mChildImageryMap.end() != iter && iter->second == pImagery ) {
+			ImageryManager* imgMgr = ImageryManager::getSingletonPtr();
+			if ( imgMgr )
+				imgMgr->_unregisterImagery( iter->second );
+			mChildImageryMap.erase( iter );
+			return;
 		}
 		std::stringstream ss;
 		ss << "(0x" << ( unsigned int ) pImagery << ") " << pImagery->getName();
@@ -96,17 +99,16 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Imageset::destroyImagery( String name ) {
-		Imageset::destroyImagery( Imageset::getImagery( name ).get() );
+		ImageryPtr imgptr = Imageset::getImagery( name );
+		if ( !imgptr )
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Could not find Imagery: " + name, "Imageset::destroyImagery" );
+		Imageset::destroyImagery( imgptr.get() );
 	}
 	//############################################################################
 	ImageryPtr Imageset::getImagery( String imageryName ) const {
-		ImageryPtrList::const_iterator iter = mChildImageryList.begin();
-		while ( mChildImageryList.end() != iter ) {
-			if (( *iter )->mName == imageryName ) {
-				return ImageryPtr(( *iter ) );
-			}
-			iter++;
-		}
+		ImageryPtrMap::const_iterator iter = mChildImageryMap.find( imageryName );
+		if ( mChildImageryMap.end() != iter )
+			return iter->second;
 		return ImageryPtr( 0 );
 	}
 	//############################################################################
@@ -117,19 +119,18 @@ namespace OpenGUI {
 	void Imageset::destroyAllImagery() {
 		LogManager::SlogMsg( "Imageset", OGLL_INFO2 ) << "(" << mFilename << ") "
 		<< "Destroying All Imagery..." << Log::endlog;
-		ImageryPtrList tmpList = mChildImageryList;
-		ImageryPtrList::iterator iter = tmpList.begin();
-		while ( tmpList.end() != iter ) {
-			Imageset::destroyImagery(( *iter ).get() );
-			iter++;
+		ImageryManager* imgMgr = ImageryManager::getSingletonPtr();
+		if ( imgMgr ) {
+			for ( ImageryPtrMap::iterator iter = mChildImageryMap.begin(); mChildImageryMap.end() != iter; iter++ )
+				imgMgr->_unregisterImagery( iter->second );
 		}
-		mChildImageryList.clear();
+		mChildImageryMap.clear();
 	}
 	//############################################################################
 	Imageset::ImageryList Imageset::getImageryList() const {
 		ImageryList retval;
-		for ( ImageryPtrList::const_iterator iter = mChildImageryList.begin(); mChildImageryList.end() != iter; iter++ ) {
-			retval.push_back(( *iter )->mName );
+		for ( ImageryPtrMap::const_iterator iter = mChildImageryMap.begin(); mChildImageryMap.end() != iter; iter++ ) {
+			retval.push_back( iter->first );
 		}
 		retval.sort();
 		return retval;
@@ -11,6 +11,7 @@
 #include "OpenGUI_Types.h"
 #include "OpenGUI_Texture.h"
 #include "OpenGUI_Imagery.h"
+#include "OpenGUI_HashMap.h"
 
 namespace OpenGUI {
 
@@ -82,7 +83,8 @@ namespace OpenGUI {
 		virtual void finalize(); //finalizer from RefObject
 		String mFilename;
 		TexturePtr mpTexture;
-		ImageryPtrList mChildImageryList;
+		typedef HashMap<String, ImageryPtr> ImageryPtrMap;
+		ImageryPtrMap mChildImageryMap;
 	};
 	//! Handle to the reference counted, auto deleting Imageset object
 	typedef RefObjHandle<Imageset> ImagesetPtr; // we use RefObject because it holds the ref count inside the object referenced
@@ -12,6 +12,7 @@ namespace OpenGUI {
 	//############################################################################
 	Object::Object() {
 		mEventReceiver.mParent = this;
+		mObjectKind = 0;
 	}
 	//############################################################################
 	Object::~Object() {}
@@ -25,67 +26,67 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Object::getProperty( const String& propertyName, Value& valueOut ) {
-		ObjectAccessorList* oal = getAccessors();
-		if ( !oal ) {
-			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "getAccessors() returned invalid ObjectAccessorList", "Object::getProperty" );
-		} else {
-			ObjectAccessor* accessor = oal->getAccessor( propertyName );
-			if ( !accessor ) {
-				OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "getAccessor( '"
-						  + propertyName
-						  + "' ) returned invalid ObjectAccessor", "Object::getProperty" );
-			} else {
-				if ( accessor->_getAccessorType() != ObjectAccessor::TYPE_PROPERTY ) {
-					OG_THROW( Exception::OP_FAILED, "ObjectAccessor: '"
-							  + propertyName
-							  + "' is not TYPE_PROPERTY", "Object::getProperty" );
-				} else {
-					ObjectProperty* prop = dynamic_cast<ObjectProperty*>( accessor );
-					if ( prop ) {
-						prop->get( *this, valueOut );
-					} else {
-						OG_THROW( Exception::OP_FAILED, "ObjectAccessor: '"
-								  + propertyName
-								  + "' is TYPE_PROPERTY but failed dynamic_cast<ObjectProperty*>", "Object::getProperty" );
-					}
-				}
-			}
-		}
+		PropertyHandle handle = resolveProperty( propertyName );
+		handle.mProperty->get( *this, valueOut );
 	}
 	//############################################################################
 	void Object::setProperty( const String& propertyName, Value& valueIn ) {
+		setProperty( resolveProperty( propertyName ), valueIn );
+	}
+	//############################################################################
+	/*! The returned handle is always valid, as failure to resolve the property throws.
+	Lookups are answered from the ObjectAccessorList's cache after the first resolve
+	of a name for a class, so this is cheap, but not as cheap as keeping the handle. */
+	PropertyHandle Object::resolveProperty( const String& propertyName ) {
 		ObjectAccessorList* oal = getAccessors();
-		if ( !oal ) {
-			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "getAccessors() returned invalid ObjectAccessorList", "Object::setProperty" );
-		} else {
-			ObjectAccessor* accessor = oal->getAccessor( propertyName );
-			if ( !accessor ) {
-				OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "getAccessor( '"
-						  + propertyName
-						  + "' ) returned invalid ObjectAccessor", "Object::setProperty" );
-			} else {
-				if ( accessor->_getAccessorType() != ObjectAccessor::TYPE_PROPERTY ) {
-					OG_THROW( Exception::OP_FAILED, "ObjectAccessor: '"
-							  + propertyName
-							  + "' is not TYPE_PROPERTY", "Object::setProperty" );
-				} else {
-					ObjectProperty* prop = dynamic_cast<ObjectProperty*>( accessor );
-					if ( prop ) {
-						if ( !prop->getPermSettable() ) {
-							OG_THROW( Exception::OP_FAILED, "Property is read only: '"
-									  + propertyName
-									  + "'", "Object::setProperty" );
-						} else {
-							prop->set( *this, valueIn );
-						}
-					} else {
-						OG_THROW( Exception::OP_FAILED, "ObjectAccessor: '"
-								  + propertyName
-								  + "' is TYPE_PROPERTY but failed dynamic_cast<ObjectProperty*>", "Object::setProperty" );
-					}
-				}
-			}
+		if ( !oal )
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "getAccessors() returned invalid ObjectAccessorList", "Object::resolveProperty" );
+
+		ObjectAccessor* accessor = oal->getAccessor( propertyName );
+		if ( !accessor )
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "getAccessor( '"
+					  + propertyName
+					  + "' ) returned invalid ObjectAccessor", "Object::resolveProperty" );
+		if ( accessor->_getAccessorType() != ObjectAccessor::TYPE_PROPERTY )
+			OG_THROW( Exception::OP_FAILED, "ObjectAccessor: '"
+					  + propertyName
+					  + "' is not TYPE_PROPERTY", "Object::resolveProperty" );
+		ObjectProperty* prop = dynamic_cast<ObjectProperty*>( accessor );
+		if ( !prop )
+			OG_THROW( Exception::OP_FAILED, "ObjectAccessor: '"
+					  + propertyName
+					  + "' is TYPE_PROPERTY but failed dynamic_cast<ObjectProperty*>", "Object::resolveProperty" );
+
+		PropertyHandle handle;
+		handle.mName = propertyName;
+		handle.mList = oal;
+		handle.mProperty = prop;
+		handle.mSettable = prop->getPermSettable();
+		return handle;
+	}
+	//############################################################################
+	void Object::getProperty( const PropertyHandle& handle, Value& valueOut ) {
+		if ( !handle.isValid() )
+			OG_THROW( Exception::ERR_INVALIDPARAMS, "PropertyHandle has not been resolved", "Object::getProperty" );
+		if ( handle.mList != getAccessors() ) {
+			getProperty( handle.getName(), valueOut ); // resolved for another class
+			return;
+		}
+		handle.mProperty->get( *this, valueOut );
+	}
+	//############################################################################
+	void Object::setProperty( const PropertyHandle& handle, Value& valueIn ) {
+		if ( !handle.isValid() )
+			OG_THROW( Exception::ERR_INVALIDPARAMS, "PropertyHandle has not been resolved", "Object::setProperty" );
+		if ( handle.mList != getAccessors() ) {
+			setProperty( resolveProperty( handle.getName() ), valueIn ); // resolved for another class
+			return;
 		}
+		if ( !handle.mSettable )
+			OG_THROW( Exception::OP_FAILED, "Property is read only: '"
+					  + handle.getName()
+					  + "'", "Object::setProperty" );
+		handle.mProperty->set( *this, valueIn );
 	}
 	//############################################################################
 	void Object::callMethod( const String& methodName, ValueList& paramIn, ValueList& returnOut ) {
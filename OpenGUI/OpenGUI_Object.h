@@ -14,9 +14,41 @@
 namespace OpenGUI {
 
 	class ObjectAccessorList; //forward declaration
+	class ObjectProperty; //forward declaration
 	class Value; // forward declaration
 	class ValueList; // forward declaration
 
+	//! A property name that has already been resolved against a class of Object
+	/*! Obtained via Object::resolveProperty(). Passing a PropertyHandle to
+		Object::getProperty() or Object::setProperty() skips the by-name accessor
+		lookup and the checks that accompany it, so code that sets the same properties
+		on many objects of the same class should resolve the names once and keep
+		the handles.
+
+		A handle remains usable with Objects of any class, but only Objects that share
+		the ObjectAccessorList it was resolved from (generally, those of the same class)
+		benefit from it. Others fall back to resolving the property by name.
+	*/
+	class OPENGUI_API PropertyHandle {
+		friend class Object;
+	public:
+		//! Constructs an unresolved handle
+		PropertyHandle(): mList( 0 ), mProperty( 0 ), mSettable( false ) {}
+		//! Returns \c true if this handle has been resolved
+		bool isValid() const {
+			return mProperty != 0;
+		}
+		//! Returns the name of the property this handle was resolved from
+		const String& getName() const {
+			return mName;
+		}
+	private:
+		String mName;
+		ObjectAccessorList* mList; // the list the property was resolved through
+		ObjectProperty* mProperty;
+		bool mSettable;
+	};
+
 	//! Base class for all GUI objects. Provides an exposed interface to the Accessor and Event systems.
 	class OPENGUI_API Object {
 	public:
@@ -27,6 +59,12 @@ namespace OpenGUI {
 		void getProperty( const String& propertyName, Value& valueOut );
 		//! sets the value of \c propertyName to the contents of \c valueIn
 		void setProperty( const String& propertyName, Value& valueIn );
+		//! resolves \c propertyName for this object's class, for use with the PropertyHandle versions of getProperty() and setProperty()
+		PropertyHandle resolveProperty( const String& propertyName );
+		//! returns the value of the property referenced by \c handle via \c valueOut
+		void getProperty( const PropertyHandle& handle, Value& valueOut );
+		//! sets the value of the property referenced by \c handle to the contents of \c valueIn
+		void setProperty( const PropertyHandle& handle, Value& valueIn );
 		//! invokes \c methodName, sending \c paramIn as arguments, and catching return values in \c returnOut
 		void callMethod( const String& methodName, ValueList& paramIn, ValueList& returnOut );
 
@@ -34,7 +72,15 @@ namespace OpenGUI {
 		/*!	\param eventName The name of the event to trigger
 			\param evtArgs The EventArgs based event data, by reference */
 		void triggerEvent( const String& eventName, EventArgs& evtArgs ) {
-			getEvents()[eventName].invoke( this, evtArgs );
+			getEvents().sendEvent( eventName, evtArgs );
+		}
+		//! triggers the event of the given \c eventID, sending the given \c evtArgs
+		/*!	This avoids the name lookup performed by the String version, and should be
+			preferred for events that are triggered often.
+			\param eventID The EventID of the event to trigger
+			\param evtArgs The EventArgs based event data, by reference */
+		void triggerEvent( const EventID& eventID, EventArgs& evtArgs ) {
+			getEvents().sendEvent( eventID, evtArgs );
 		}
 		//############################################################################
 
@@ -58,10 +104,36 @@ namespace OpenGUI {
 			OT_CONTROL          = 6, //!< Object is a Control
 			OT_CONTAINERCONTROL = 7, //!< Object is a ContainerControl
 			OT_WINDOW           = 8, //!< Object is a Window
+			OT_STACKPANEL       = 9, //!< Object is a StackPanel
+			OT_GRIDPANEL        = 10, //!< Object is a GridPanel
+		};
+
+		//! Flags identifying the library base classes an Object derives from
+		/*! Unlike getObjectType(), which names only the most derived class, an Object
+			carries the flag of every one of these classes it derives from. Testing them
+			is a single load and compare, so they stand in for \c dynamic_cast in code
+			that runs per widget per frame.
+			\see isKindOf() */
+		enum Object_Kind {
+			KIND_WIDGET           = 1 << 0, //!< Object derives from Widget
+			KIND_CONTROL          = 1 << 1, //!< Object derives from Control
+			KIND_CONTAINERCONTROL = 1 << 2, //!< Object derives from ContainerControl
+			KIND_SCREEN           = 1 << 3, //!< Object derives from Screen
 		};
+		//! Returns \c true if this Object derives from every class flagged in \c kind
+		bool isKindOf( unsigned int kind ) const {
+			return ( mObjectKind & kind ) == kind;
+		}
+
+	protected:
+		//! Called by the constructors of the classes listed in Object_Kind to flag themselves
+		void _addObjectKind( unsigned int kind ) {
+			mObjectKind |= kind;
+		}
 
 	private:
 		EventReceiver mEventReceiver;
+		unsigned int mObjectKind;
 	};
 
 }//namespace OpenGUI{
@@ -16,8 +16,13 @@ namespace OpenGUI {
 		return true;
 	}
 	//############################################################################
+	// Bumped whenever any list is altered. Lists are chained, so a change anywhere
+	// can alter the result of a recursive lookup through any list below it.
+	static unsigned int gAccessorGeneration = 1;
+	//############################################################################
 	ObjectAccessorList::ObjectAccessorList() {
 		mParent = 0;
+		mResolvedGeneration = 0;
 	}
 	//############################################################################
 	ObjectAccessorList::~ObjectAccessorList() {}
@@ -28,14 +33,32 @@ namespace OpenGUI {
 	\note Throws an exception whenever the requested \c accessorName cannot
 	be found, and there is no available parent in which to defer the call. */
 	ObjectAccessor* ObjectAccessorList::getAccessor( const String& accessorName, bool recursive ) {
+		//answer recursive lookups from the cache when it is current
+		if ( recursive ) {
+			if ( mResolvedGeneration != gAccessorGeneration ) {
+				mResolved.clear();
+				mResolvedGeneration = gAccessorGeneration;
+			} else {
+				ResolvedMap::iterator iter = mResolved.find( accessorName );
+				if ( iter != mResolved.end() )
+					return iter->second;
+			}
+		}
+
 		//try to find locally
 		ObjectAccessorMap::iterator iter = mObjectAccessorMap.find( accessorName );
-		if ( iter != mObjectAccessorMap.end() )
+		if ( iter != mObjectAccessorMap.end() ) {
+			if ( recursive )
+				mResolved[accessorName] = iter->second;
 			return iter->second;
+		}
 
 		//if not found then recurse if appropriate
-		if ( recursive && mParent )
-			return mParent->getAccessor( accessorName, true );
+		if ( recursive && mParent ) {
+			ObjectAccessor* accessor = mParent->getAccessor( accessorName, true );
+			mResolved[accessorName] = accessor;
+			return accessor;
+		}
 
 		//throw on resolve failure
 		OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Failed to resolve Accessor name: " + accessorName, "ObjectAccessorList::getAccessor" );
@@ -46,10 +69,12 @@ namespace OpenGUI {
 	//############################################################################
 	void ObjectAccessorList::addAccessor( ObjectAccessor* accessor ) {
 		mObjectAccessorMap[accessor->getAccessorName()] = accessor;
+		gAccessorGeneration++;
 	}
 	//############################################################################
 	void ObjectAccessorList::setParent( ObjectAccessorList* parent ) {
 		mParent = parent;
+		gAccessorGeneration++;
 	}
 	//############################################################################
 	ObjectAccessorList* ObjectAccessorList::getParent() {
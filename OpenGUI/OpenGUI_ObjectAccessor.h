@@ -10,6 +10,7 @@
 #include "OpenGUI_String.h"
 #include "OpenGUI_Value.h"
 #include "OpenGUI_Object.h"
+#include "OpenGUI_HashMap.h"
 
 namespace OpenGUI {
 
@@ -103,6 +104,11 @@ namespace OpenGUI {
 
 		typedef std::map<String, ObjectAccessor*> ObjectAccessorMap;
 		ObjectAccessorMap mObjectAccessorMap;
+
+		// recursive lookups that have already been resolved through the parent chain
+		typedef HashMap<String, ObjectAccessor*> ResolvedMap;
+		ResolvedMap mResolved;
+		unsigned int mResolvedGeneration; // mResolved is stale unless this matches the global generation
 	};
 
 
@@ -6,8 +6,11 @@
 #define F5ED205F_518A_42e8_86FF_D196D23C0C6A
 
 #include "OpenGUI_Platform.h"
+#include "OpenGUI_CONFIG.h"
 
 #include <cstdlib>
+#include <cstring>
+#include <new>
 #include <cmath>
 #include <ctime>
 #include <string>
@@ -34,11 +37,31 @@
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #include <Mmsystem.h>
+#ifdef OPENGUI_THREADED_UPDATE
+#define OPENGUI_ATOMIC_INCREMENT(value) InterlockedIncrement(&value)
+#define OPENGUI_ATOMIC_DECREMENT(value) InterlockedDecrement(&value)
+#define OPENGUI_ATOMIC_SET_POINTER(target,value) InterlockedExchangePointer((PVOID volatile*)&(target),(PVOID)(value))
+#endif
 #endif
 
 #if OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
 #include <dlfcn.h>
 #define strcmpi strcasecmp
+#ifdef OPENGUI_THREADED_UPDATE
+#define OPENGUI_ATOMIC_INCREMENT(value) __sync_add_and_fetch(&value,1)
+#define OPENGUI_ATOMIC_DECREMENT(value) __sync_sub_and_fetch(&value,1)
+#define OPENGUI_ATOMIC_SET_POINTER(target,value) (__sync_synchronize(),__sync_lock_test_and_set(&(target),(value)))
+#endif
+#endif
+
+// reference counts are only shared between threads when Screens can be drawn on several
+#ifndef OPENGUI_THREADED_UPDATE
+#define OPENGUI_ATOMIC_INCREMENT(value) (++(value))
+#define OPENGUI_ATOMIC_DECREMENT(value) (--(value))
+#define OPENGUI_ATOMIC_SET_POINTER(target,value) ((target)=(value))
+#define OPENGUI_ATOMIC_LONG long
+#else
+#define OPENGUI_ATOMIC_LONG volatile long
 #endif
 
 #endif
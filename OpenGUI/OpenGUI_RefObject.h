@@ -30,19 +30,22 @@ namespace OpenGUI {
 	public:
 		RefObject(): mRefCount( 0 ) {}
 		virtual ~RefObject() {}
+		//! Returns the number of handles currently held to this object
+		unsigned int getHandleCount() const {
+			return ( unsigned int ) mRefCount;
+		}
 	protected:
 		//! This is called when the last handle to this object is destroyed.
 		virtual void finalize() = 0;
 	private:
 		void _reference() {
-			mRefCount++;
+			OPENGUI_ATOMIC_INCREMENT( mRefCount );
 		}
 		void _unreference() {
-			mRefCount--;
-			if ( mRefCount == 0 )
+			if ( OPENGUI_ATOMIC_DECREMENT( mRefCount ) == 0 )
 				finalize();
 		}
-		size_t mRefCount;
+		OPENGUI_ATOMIC_LONG mRefCount; // atomic under OPENGUI_THREADED_UPDATE, as handles can be copied by Screens drawing on other threads
 	};
 
 
@@ -52,9 +55,11 @@ namespace OpenGUI {
 	private:
 		//template<>
 		RefObject* m_Handle;
+		OBJECT* m_Object; // m_Handle already cast to OBJECT, so dereferencing does not need a dynamic_cast
 	public:
 		//! Create a handle from an existing object pointer, or empty
 		RefObjHandle( RefObject* counted_object = 0 ): m_Handle( counted_object ) {
+			m_Object = dynamic_cast<OBJECT*>( m_Handle );
 			if ( m_Handle )
 				m_Handle->_reference();
 		}
@@ -65,31 +70,34 @@ namespace OpenGUI {
 		//! Create a handle from another handle
 		RefObjHandle( const RefObjHandle<OBJECT> &other_handle ) {
 			m_Handle = other_handle.m_Handle;
+			m_Object = other_handle.m_Object;
 			if ( m_Handle )	m_Handle->_reference();
 		}
 
 		//! Assignment operator
 		RefObjHandle<OBJECT>& operator=( const RefObjHandle<OBJECT>& right ) {
+			// reference first, so self assignment cannot finalize the object
+			if ( right.m_Handle ) right.m_Handle->_reference();
 			if ( m_Handle ) m_Handle->_unreference();
 			m_Handle = right.m_Handle;
-			if ( m_Handle ) m_Handle->_reference();
+			m_Object = right.m_Object;
 			return *this;
 		}
 
 		//! Return the total number of handles to the object, yourself included.
 		unsigned int getHandleCount() {
 			if ( m_Handle )
-				return m_Handle->mRefCount;
+				return ( unsigned int ) m_Handle->mRefCount;
 			return 0;
 		}
 
 		//! The usual *Handle resolving
 		OBJECT& operator*() const {
-			return *( dynamic_cast<OBJECT*>( m_Handle ) );
+			return *m_Object;
 		}
 		//! The usual Handle->something resolving
 		OBJECT* operator->() const {
-			return dynamic_cast<OBJECT*>( m_Handle );
+			return m_Object;
 		}
 
 		//! This makes "if( Handle )" work just like "if( !Handle.isNull() )"
@@ -137,7 +145,7 @@ namespace OpenGUI {
 		}
 		//! Returns the carried pointer in raw form.
 		OBJECT* get() const {
-				return ( dynamic_cast<OBJECT*>( m_Handle ) );
+				return m_Object;
 			}
 	};
 } //namespace OpenGUI {
@@ -0,0 +1,14 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#include "OpenGUI_RefPtr.h"
+
+namespace OpenGUI {
+
+	//############################################################################
+	void RefCounted::__suicide() {
+		delete this;
+	}
+	//############################################################################
+} //namespace OpenGUI {
@@ -14,112 +14,73 @@
 // Do what you want with it. I think everyone should have a decent RefPtr class.
 //             - Eric Shorkey (August 7th, 2006)
 
-// Note: If you are going to use this, remove the funny #define logic by  following the
-//       embedded removal instructions for #define areas that should be removed.
-//       And don't forget to change the #ifndef/#def at the top to something new!
+// Note: If you are going to use this, define RefCounted::__suicide() as "delete this;"
+//       and drop the OPENGUI_API. And don't forget to change the #ifndef/#def at the
+//       top to something new!
 
 #include "OpenGUI_PreRequisites.h"
+#include "OpenGUI_Exports.h"
 
 
 /*
 	Note to OpenGUI editors:
-	The following #define system and __suicide()/__killPayload() are used to ensure
-	that RefPtr's and their payloads are only destroyed from within OpenGUI.dll.
+	RefCounted::__suicide() is intentionally defined out of line (OpenGUI_RefPtr.cpp)
+	to ensure that RefPtr payloads are only destroyed from within OpenGUI.dll.
 	This is necessary because we officially support Ogre, and Ogre currently ships with
 	a memory manager in the SDK that can not be properly turned off. As such, any
 	OpenGUI created data must be deleted from within OpenGUI, or Ogre's memory manager
 	will complain.
 */
 
-
-// Code Stealers - SNIP HERE
-#ifdef OPENGUI_DEBUG
-#	ifdef OPENGUI_EXPORTS
-#		define DELETE_HERE
-#	else
-#		define DELETE_ELSEWHERE
-#	endif
-#else
-#	define DELETE_HERE
-#endif
-// Code Stealers - END SNIP HERE
-
 namespace OpenGUI {
 	template<typename T>
 	class RefPtr;
 
-	template<typename T>
-	class __RefObj {
-		friend class RefPtr<T>;
-	private:
-// Code Stealers - SNIP HERE
-#ifdef DELETE_HERE
-// Code Stealers - END SNIP HERE
-		void OPENGUI_API __suicide() {
-			delete this;
-		}
-		void OPENGUI_API __killPayload() {
-			if ( m_objPtr )
-				delete m_objPtr;
-			m_objPtr = 0;
+	//! Base class for any object that is to be held by a RefPtr
+	/*! The reference count lives inside of the object itself, so a RefPtr is nothing
+		more than a pointer to the object, and creating the object is the only allocation.
+		Because the count travels with the object, a RefPtr can also be safely created
+		from a raw pointer to an object that is already held by other RefPtrs.
+	*/
+	class OPENGUI_API RefCounted {
+		template<typename> friend class RefPtr;
+	public:
+		RefCounted(): __refcount( 0 ) {}
+		//! Copies are new objects, and do not inherit the references of the original
+		RefCounted( const RefCounted& ): __refcount( 0 ) {}
+		//! Assignment leaves the reference count untouched
+		RefCounted& operator=( const RefCounted& ) {
+			return *this;
 		}
-// Code Stealers - SNIP HERE
-#endif
-#ifdef DELETE_ELSEWHERE
-		void OPENGUI_API __suicide();
-		void OPENGUI_API __killPayload();
-#endif
-// Code Stealers - END SNIP HERE
-
-		__RefObj( T *payload ) {
-			m_objPtr = payload;
-			refcount = 1;
+	protected:
+		virtual ~RefCounted() {}
+	private:
+		void __ref() {
+			OPENGUI_ATOMIC_INCREMENT( __refcount );
 #ifdef REFPTR_DEBUG
-			std::stringstream ss;
-			ss << "REFPTR_" << m_objPtr << ".log";
-			std::ofstream out;
-			out.open( ss.str().c_str(), std::ios::app );
-			out << "[+] NEW RefObj: 0x" << this << " : (0x" << m_objPtr << ") {" << refcount << "}\n";
-			out.close();
+			__log( "[R] REF" );
 #endif
 		}
-		~__RefObj() {
+		void __unref() {
+			const long remaining = OPENGUI_ATOMIC_DECREMENT( __refcount );
 #ifdef REFPTR_DEBUG
-			std::stringstream ss;
-			ss << "REFPTR_" << m_objPtr << ".log";
-			std::ofstream out;
-			out.open( ss.str().c_str(), std::ios::app );
-			out << "[-] DEL RefObj: 0x" << this << " : (0x" << m_objPtr << ") {" << refcount << "}\n";
-			out.close();
+			__log( "[U] URF" );
 #endif
-			__killPayload();
+			if ( remaining == 0 )
+				__suicide();
 		}
-		void ref() {
-			refcount++;
+		void __suicide(); // deletes this object (from within OpenGUI)
 #ifdef REFPTR_DEBUG
+		void __log( const char* action ) {
 			std::stringstream ss;
-			ss << "REFPTR_" << m_objPtr << ".log";
+			ss << "REFPTR_" << this << ".log";
 			std::ofstream out;
 			out.open( ss.str().c_str(), std::ios::app );
-			out << "[R] REF RefObj: 0x" << this << " : (0x" << m_objPtr << ") {" << refcount << "}\n";
+			out << action << " RefCounted: 0x" << this << " {" << __refcount << "}\n";
 			out.close();
-#endif
 		}
-		void unref() {
-			refcount--;
-#ifdef REFPTR_DEBUG
-			std::stringstream ss;
-			ss << "REFPTR_" << m_objPtr << ".log";
-			std::ofstream out;
-			out.open( ss.str().c_str(), std::ios::app );
-			out << "[U] URF RefObj: 0x" << this << " : (0x" << m_objPtr << ") {" << refcount << "}\n";
-			out.close();
 #endif
-			if ( refcount == 0 )
-				__suicide();
-		}
-		T* m_objPtr;
-		unsigned int refcount;
+		OPENGUI_ATOMIC_LONG __refcount; // atomic under OPENGUI_THREADED_UPDATE, so RefPtrs can be copied on several threads at once
 	};
 
 	//! This is the base template used for any reference counted pointers in %OpenGUI
@@ -127,53 +88,52 @@ namespace OpenGUI {
 		native form. If you need a RefPtr for your application's use, feel free to steal
 		RefPtr.h from this source tree. Instructions, details, and full source are held
 		within that file.
+
+		\c T must derive from RefCounted, which holds the reference count.
 	*/
 	template<typename T>
 	class RefPtr {
 	public:
 		//! Create a RefPtr from an existing pointer, or empty
-		RefPtr( T *ptr = 0 ) {
-			m_refObjPtr = 0;
-			if ( ptr )
-				m_refObjPtr = new __RefObj<T>( ptr );
+		RefPtr( T *ptr = 0 ): m_objPtr( ptr ) {
+			if ( m_objPtr ) m_objPtr->__ref();
 		}
 		//! Create a RefPtr from another RefPtr
-		RefPtr( const RefPtr<T> &ptr ) {
-			m_refObjPtr = ptr.m_refObjPtr;
-			if ( m_refObjPtr )	m_refObjPtr->ref();
+		RefPtr( const RefPtr<T> &ptr ): m_objPtr( ptr.m_objPtr ) {
+			if ( m_objPtr ) m_objPtr->__ref();
 		}
 		//! Destructor does the usual unreferencing operation
 		~RefPtr() {
-			if ( m_refObjPtr )
-				m_refObjPtr->unref();
+			if ( m_objPtr ) m_objPtr->__unref();
 		}
 
 		//! Return the total number of references to the stored pointer, yourself included.
 		unsigned int getRefCount() {
-			if ( m_refObjPtr )
-				return m_refObjPtr->refcount;
+			if ( m_objPtr )
+				return ( unsigned int ) m_objPtr->__refcount;
 			return 0;
 		}
 
 		//! Assignment operator
 		RefPtr<T>& operator=( const RefPtr<T>& ptr ) {
-			if ( m_refObjPtr ) m_refObjPtr->unref();
-			m_refObjPtr = ptr.m_refObjPtr;
-			if ( m_refObjPtr ) m_refObjPtr->ref();
+			// reference first, so self assignment cannot destroy the payload
+			if ( ptr.m_objPtr ) ptr.m_objPtr->__ref();
+			if ( m_objPtr ) m_objPtr->__unref();
+			m_objPtr = ptr.m_objPtr;
 			return *this;
 		}
 
 		//! The usual *RefPtr resolving
 		T& operator*() const {
-			return *( m_refObjPtr->m_objPtr );
+			return *m_objPtr;
 		}
 		//! The usual RefPtr->somthing resolving
 		T* operator->() const {
-			return ( m_refObjPtr->m_objPtr );
+			return m_objPtr;
 		}
 		//! This makes "if( RefPtr )" work just like "if( !RefPtr.isNull() )"
 		operator bool() const {
-			return m_refObjPtr == 0 ? false : true;
+			return m_objPtr == 0 ? false : true;
 		}
 
 		//! This allows us to use "if( RefPtr == NULL )" and "if( RefPtr == 0 )"
@@ -192,13 +152,11 @@ namespace OpenGUI {
 		}
 		//! Used for "if( RefPtr == normal_pointer )"
 		bool operator ==( const T* p ) const {
-			if ( m_refObjPtr )
-				return m_refObjPtr->m_objPtr  == p;
-			return p == 0;
+			return m_objPtr == p;
 		}
 		//! Used for "if( RefPtr == RefPtr )"
 		bool operator==( const RefPtr& r ) const {
-			return m_refObjPtr == r.m_refObjPtr;
+			return m_objPtr == r.m_objPtr;
 		}
 
 		//! Used for "if( RefPtr != RefPtr )"
@@ -212,14 +170,14 @@ namespace OpenGUI {
 
 		//! RefPtr.isNull() returns true if RefPtr carries no pointer
 		bool isNull()const {
-			return m_refObjPtr == 0;
+			return m_objPtr == 0;
 		}
 		//! Returns the carried pointer in raw form.
 		T* get() const {
-				return ( m_refObjPtr->m_objPtr );
+				return m_objPtr;
 			}
 	protected:
-		__RefObj<T> *m_refObjPtr;
+		T* m_objPtr;
 	};
 }
 ;//namespace OpenGUI{
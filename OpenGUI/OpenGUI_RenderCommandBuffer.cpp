@@ -0,0 +1,184 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#include "OpenGUI_RenderCommandBuffer.h"
+#include "OpenGUI_Renderer.h"
+#include "OpenGUI_TextureManager.h"
+#include "OpenGUI_TextureData.h"
+#include "OpenGUI_Viewport.h"
+
+namespace OpenGUI {
+	//############################################################################
+	RenderCommandBuffer::RenderCommandBuffer() {
+		mViewport = 0;
+		mScreen = 0;
+		mContext = 0;
+		mContextKnown = false;
+	}
+	//############################################################################
+	RenderCommandBuffer::~RenderCommandBuffer() {
+		clear();
+		for ( TextureDataList::iterator iter = mSpareUploads.begin(); iter != mSpareUploads.end(); iter++ )
+			delete( *iter );
+	}
+	//############################################################################
+	void RenderCommandBuffer::beginViewport( Viewport* viewport, Screen* screen, const FRect& updateArea ) {
+		Command cmd;
+		cmd.type = Command::BEGIN_VIEWPORT;
+		cmd.count = 0;
+		cmd.viewport = viewport;
+		cmd.screen = screen;
+		cmd.area = updateArea;
+		mCommands.push_back( cmd );
+		mViewport = viewport;
+		mScreen = screen;
+		mContext = 0;
+		mContextKnown = false; // whatever was selected before is gone once the viewport is selected
+	}
+	//############################################################################
+	void RenderCommandBuffer::endViewport() {
+		Command cmd;
+		cmd.type = Command::END_VIEWPORT;
+		cmd.count = 0;
+		cmd.viewport = mViewport;
+		cmd.screen = mScreen;
+		mCommands.push_back( cmd );
+		mViewport = 0;
+		mScreen = 0;
+	}
+	//############################################################################
+	void RenderCommandBuffer::selectRenderContext( RenderTexture* context ) {
+		if ( mContextKnown && mContext == context )
+			return;
+		Command cmd;
+		cmd.type = Command::SELECT_CONTEXT;
+		cmd.context = context;
+		cmd.count = 0;
+		mCommands.push_back( cmd );
+		mContext = context;
+		mContextKnown = true;
+	}
+	//############################################################################
+	void RenderCommandBuffer::clearContents() {
+		Command cmd;
+		cmd.type = Command::CLEAR_CONTENTS;
+		cmd.count = 0;
+		mCommands.push_back( cmd );
+	}
+	//############################################################################
+	void RenderCommandBuffer::addRenderOperation( RenderOperation& renderOp ) {
+		// consecutive operations share a single command
+		if ( mCommands.empty() || mCommands.back().type != Command::RENDER ) {
+			Command cmd;
+			cmd.type = Command::RENDER;
+			cmd.count = 0;
+			mCommands.push_back( cmd );
+		}
+		mCommands.back().count++;
+
+		// reuse an entry released by clear() if we have one, to save the allocation
+		if ( mSpareOperations.empty() )
+			mOperations.push_back( RenderOperation() );
+		else
+			mOperations.splice( mOperations.end(), mSpareOperations, mSpareOperations.begin() );
+		RenderOperation& op = mOperations.back();
+		op.texture = renderOp.texture;
+		op.mask = renderOp.mask;
+		op.triangleList = renderOp.triangleList;
+		renderOp.triangleList = 0;
+	}
+	//############################################################################
+	void RenderCommandBuffer::updateTexture( Texture* texture, const TextureData* textureData ) {
+		// only the latest contents matter, as long as nothing has drawn with the texture since
+		TextureData* upload = 0;
+		for ( CommandList::reverse_iterator cmd = mCommands.rbegin(); cmd != mCommands.rend() && cmd->type == Command::UPDATE_TEXTURE; cmd++ ) {
+			if ( cmd->texture.get() == texture ) {
+				upload = mUploads[cmd->count];
+				break;
+			}
+		}
+		if ( !upload ) {
+			if ( mSpareUploads.empty() ) {
+				upload = new TextureData;
+			} else {
+				upload = mSpareUploads.back();
+				mSpareUploads.pop_back();
+			}
+			mUploads.push_back( upload );
+			Command cmd;
+			cmd.type = Command::UPDATE_TEXTURE;
+			cmd.texture = TexturePtr( texture );
+			cmd.count = mUploads.size() - 1;
+			mCommands.push_back( cmd );
+		}
+
+		const int width = textureData->getWidth();
+		const int height = textureData->getHeight();
+		const int bpp = textureData->getBPP();
+		if ( upload->getPixelData() && upload->getWidth() == width && upload->getHeight() == height && upload->getBPP() == bpp )
+			memcpy( upload->getPixelData(), textureData->getPixelData(), width * height * bpp );
+		else
+			upload->setData( width, height, bpp, textureData->getPixelData() );
+	}
+	//############################################################################
+	void RenderCommandBuffer::submit() {
+		Renderer& renderer = Renderer::getSingleton();
+		TextureManager& texMgr = TextureManager::getSingleton();
+		RenderOperationList::iterator op = mOperations.begin();
+		for ( CommandList::iterator cmd = mCommands.begin(); cmd != mCommands.end(); cmd++ ) {
+			switch ( cmd->type ) {
+			case Command::BEGIN_VIEWPORT:
+				cmd->viewport->mUpdateArea = cmd->area;
+				renderer.selectViewport( cmd->viewport ); // inform renderer of new viewport selection
+				renderer.preRenderSetup(); // begin render sequence
+				cmd->viewport->preUpdate( cmd->screen ); // inform the viewport that it is about to be updated
+				break;
+			case Command::END_VIEWPORT:
+				cmd->viewport->postUpdate( cmd->screen ); // inform the viewport that it is done being updated
+				renderer.postRenderCleanup(); // end render sequence
+				break;
+			case Command::SELECT_CONTEXT:
+				renderer.selectRenderContext( cmd->context.get() );
+				break;
+			case Command::CLEAR_CONTENTS:
+				renderer.clearContents();
+				break;
+			case Command::UPDATE_TEXTURE: {
+				// the TextureManager makes its other texture calls one at a time, so this waits its turn
+				UpdateLock lock( texMgr._getMutex() );
+				renderer.updateTextureFromTextureData( cmd->texture.get(), mUploads[cmd->count] );
+			}
+			break;
+			case Command::RENDER:
+				for ( size_t i = 0; i < cmd->count; i++, op++ ) {
+					// keep the texture memory budget informed of what is being drawn
+					if ( op->texture )
+						texMgr._touchTexture( op->texture.get() );
+					if ( op->mask )
+						texMgr._touchTexture( op->mask.get() );
+					renderer.doRenderOperation( *op );
+				}
+				break;
+			}
+		}
+	}
+	//############################################################################
+	void RenderCommandBuffer::clear() {
+		mCommands.clear();
+		for ( RenderOperationList::iterator op = mOperations.begin(); op != mOperations.end(); op++ ) {
+			delete op->triangleList;
+			op->triangleList = 0;
+			op->texture = TexturePtr();
+			op->mask = TexturePtr();
+		}
+		mSpareOperations.splice( mSpareOperations.begin(), mOperations );
+		mSpareUploads.insert( mSpareUploads.end(), mUploads.begin(), mUploads.end() );
+		mUploads.clear();
+		mViewport = 0;
+		mScreen = 0;
+		mContext = 0;
+		mContextKnown = false;
+	}
+	//############################################################################
+} // namespace OpenGUI{
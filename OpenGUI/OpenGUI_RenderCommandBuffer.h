@@ -0,0 +1,109 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#ifndef D80D4BCB_0158_4AC2_B9AD_50392B9C2C0F
+#define D80D4BCB_0158_4AC2_B9AD_50392B9C2C0F
+
+#include "OpenGUI_PreRequisites.h"
+#include "OpenGUI_Exports.h"
+#include "OpenGUI_RenderOperation.h"
+#include "OpenGUI_RenderTexture.h"
+
+namespace OpenGUI {
+	class Screen; //forward declaration
+	class Viewport; //forward declaration
+	class TextureData; //forward declaration
+
+	//! Records the Renderer calls needed to draw a Screen, so they can be sent to the Renderer later
+	/*! Each Screen owns two of these, which it records into alternately. The Brushes that draw
+	to a Screen, including the render texture Brushes that it creates, add their output here
+	instead of calling the Renderer, so drawing a Screen touches nothing that belongs to another
+	Screen. The Viewport selection and notifications that surround an update are recorded too,
+	so a command buffer holds everything needed to present the update, and can be submitted
+	by whichever thread renders.
+
+	Texture updates, such as the font atlas uploads made while text is drawn, are recorded as
+	well, along with a copy of the new contents, so that the recording thread never waits on the
+	thread that submits.
+
+	Every texture and render context mentioned by a command is referenced until the command
+	buffer is cleared, so nothing it draws with can be destroyed before it is submitted. */
+	class OPENGUI_API RenderCommandBuffer {
+	public:
+		RenderCommandBuffer();
+		~RenderCommandBuffer();
+
+		//! Begins an update of \c viewport by \c screen, which redraws \c updateArea of the Viewport
+		/*! When submitted, this sets the update area of the Viewport, selects it in the Renderer, and
+		calls Renderer::preRenderSetup() and Viewport::preUpdate(). */
+		void beginViewport( Viewport* viewport, Screen* screen, const FRect& updateArea );
+		//! Ends the update begun by beginViewport()
+		/*! When submitted, this calls Viewport::postUpdate() and Renderer::postRenderCleanup(). */
+		void endViewport();
+		//! Directs the commands that follow to the given render \c context, or to the Viewport if \c context is 0
+		/*! Nothing is recorded if that context is already selected. */
+		void selectRenderContext( RenderTexture* context );
+		//! Records a clear of the currently selected render context
+		void clearContents();
+		//! Records the given render operation, taking ownership of its triangle list
+		/*! The \c renderOp is left with no triangle list. */
+		void addRenderOperation( RenderOperation& renderOp );
+		//! Records an update of \c texture to the contents of \c textureData
+		/*! The contents are copied, so \c textureData may go on changing while this waits to be
+		submitted. An update that directly follows an earlier update of the same texture reuses
+		its copy, so a texture that changes many times while recording is only sent once. */
+		void updateTexture( Texture* texture, const TextureData* textureData );
+
+		//! Sends all of the recorded commands to the Renderer, in the order they were recorded
+		/*! The textures of each RenderOperation are reported to the TextureManager as they are
+		sent. The TextureManager is only locked while it looks at each texture, or while a texture
+		update is sent, so textures can be created and updated by another thread during a
+		submission. The commands are kept until clear() is called. */
+		void submit();
+		//! Discards all recorded commands, releasing the textures they referenced
+		void clear();
+
+		//! Returns \c true if there is nothing to submit
+		bool isEmpty() const {
+			return mCommands.empty();
+		}
+		//! Returns the number of render operations recorded
+		size_t getOperationCount() const {
+			return mOperations.size();
+		}
+
+	private:
+		struct Command {
+			enum Type {
+				BEGIN_VIEWPORT, // select viewport for screen, and begin the update of area
+				END_VIEWPORT, // end the update of viewport by screen
+				SELECT_CONTEXT, // select context
+				CLEAR_CONTENTS, // clear the current context
+				UPDATE_TEXTURE, // replace the contents of texture with mUploads[count]
+				RENDER // send the next count operations
+			} type;
+			RenderTexturePtr context;
+			TexturePtr texture;
+			size_t count;
+			Viewport* viewport;
+			Screen* screen;
+			FRect area;
+		};
+		typedef std::vector<Command> CommandList;
+		CommandList mCommands;
+		RenderOperationList mOperations; // operations of every RENDER command, in order
+		RenderOperationList mSpareOperations; // emptied entries kept by clear() for reuse
+		typedef std::vector<TextureData*> TextureDataList;
+		TextureDataList mUploads; // contents of every UPDATE_TEXTURE command
+		TextureDataList mSpareUploads; // copies kept by clear() for reuse, as they are often the same size
+
+		Viewport* mViewport; // viewport of the last BEGIN_VIEWPORT
+		Screen* mScreen; // screen of the last BEGIN_VIEWPORT
+		RenderTexture* mContext; // context selected by the last SELECT_CONTEXT
+		bool mContextKnown; // false until a context has been selected since the last clear
+	};
+
+} // namespace OpenGUI{
+
+#endif // D80D4BCB_0158_4AC2_B9AD_50392B9C2C0F
@@ -30,5 +30,25 @@ namespace OpenGUI {
 		OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Render Textures not supported", __FUNCTION__ );
 	}
 	//############################################################################
+	bool Renderer::supportsTextureEviction() {
+		return false;
+	}
+	//############################################################################
+	bool Renderer::supportsTextureRepeat() {
+		return false;
+	}
+	//############################################################################
+	bool Renderer::supportsThreadedTextures() {
+		return false;
+	}
+	//############################################################################
+	void Renderer::evictTexture( Texture* /*texture*/ ) {
+		OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Texture eviction not supported", __FUNCTION__ );
+	}
+	//############################################################################
+	void Renderer::reloadTexture( Texture* /*texture*/, const String& /*filename*/ ) {
+		OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Texture eviction not supported", __FUNCTION__ );
+	}
+	//############################################################################
 };
 
@@ -243,6 +243,83 @@ namespace OpenGUI {
 		will take place.
 		*/
 		virtual void destroyRenderTexture( RenderTexture* texturePtr );
+//@}
+//!\name Texture Eviction Support (optional)
+//@{
+		//! Renderer implementations that can release and later restore file based textures should return \c true. The default is to return \c false.
+		/*! This is used by the TextureManager memory budget. When this returns \c false, the
+		memory budget is still tracked, but textures are never evicted.
+
+		\attention
+		This virtual function has a default implementation.
+		This allows renderer implementations that do not support texture eviction
+		to simply ignore the existence of this function and the correct functionality
+		will take place.
+		*/
+		virtual bool supportsTextureEviction();
+
+		//! Releases the graphics API resources held by the given \c texture, without destroying the Texture object.
+		/*! The Texture object must remain valid, as handles to it are still held throughout
+		the system. The texture will never be drawn while evicted, and will be restored via
+		reloadTexture() before it is drawn again.
+
+		\attention
+		This virtual function has a default implementation.
+		This allows renderer implementations that do not support texture eviction
+		to simply ignore the existence of this function and the correct functionality
+		will take place.
+		*/
+		virtual void evictTexture( Texture* texture );
+
+		//! Restores the contents of a previously evicted \c texture from the given \c filename.
+		/*! The \c filename is the same filename that was originally given to createTextureFromFile()
+		when the texture was created.
+
+		\attention
+		This virtual function has a default implementation.
+		This allows renderer implementations that do not support texture eviction
+		to simply ignore the existence of this function and the correct functionality
+		will take place.
+		*/
+		virtual void reloadTexture( Texture* texture, const String& filename );
+//@}
+//!\name Texture Repeat Support (optional)
+//@{
+		//! Renderer implementations that repeat textures for UVs outside of the 0.0 - 1.0 range should return \c true. The default is to return \c false.
+		/*! When this returns \c true, Brush will draw tiled Imagery that covers an entire texture
+		as a single quad with UVs ranging past 1.0, instead of one RenderOperation per tile. This
+		only needs to hold true for textures created from files or TextureData. Render textures are
+		never drawn this way.
+
+		\attention
+		This virtual function has a default implementation.
+		This allows renderer implementations that do not support texture repeat
+		to simply ignore the existence of this function and the correct functionality
+		will take place.
+		*/
+		virtual bool supportsTextureRepeat();
+//@}
+//!\name Threaded Update Support (optional)
+//@{
+		//! Renderer implementations that can create, update, and destroy textures from any thread should return \c true. The default is to return \c false.
+		/*! ScreenManager::setUpdateThreads() only draws Screens on worker threads when this
+		returns \c true, as drawing a Screen may create render textures and font atlas textures.
+		The TextureManager never makes more than one of these calls at a time, but they may come
+		from any of the update threads. Updates of existing textures made while drawing are recorded
+		and sent later. Every other Renderer call, including all render texture selection and
+		drawing, is still made from the thread that calls ScreenManager::updateScreens().
+
+		Applications that call ScreenManager::submitScreens() from a render thread of their own
+		also rely on this, as textures are then created and destroyed from the thread calling
+		ScreenManager::recordScreens() while the render thread is drawing with other textures.
+
+		\attention
+		This virtual function has a default implementation.
+		This allows renderer implementations that do not support threaded texture
+		management to simply ignore the existence of this function and the correct
+		functionality will take place.
+		*/
+		virtual bool supportsThreadedTextures();
 //@}
 	};
 }
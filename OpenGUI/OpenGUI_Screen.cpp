@@ -8,7 +8,9 @@
 #include "OpenGUI_System.h"
 #include "OpenGUI_Renderer.h"
 #include "OpenGUI_Brush.h"
+#include "OpenGUI_Brush_RTT.h"
 #include "OpenGUI_Control.h"
+#include "OpenGUI_ContainerControl.h"
 #include "OpenGUI_TimerManager.h"
 #include "OpenGUI_Viewport.h"
 #include "OpenGUI_TextureManager.h"
@@ -50,10 +52,10 @@ namespace OpenGUI {
 					t.vertex[i].position.y /= getDrawSize().y;
 				}
 			}
-			Renderer::getSingleton().doRenderOperation( renderOp );
+			mScreen->_getCommandBuffer().addRenderOperation( renderOp );
 		}
 		virtual void onActivate() {
-			Renderer::getSingleton().selectRenderContext( 0 );
+			mScreen->_getCommandBuffer().selectRenderContext( 0 );
 		}
 		virtual void onClear() {
 			/* we don't try to clear viewports */
@@ -114,6 +116,7 @@ namespace OpenGUI {
 	//############################################################################
 	//############################################################################
 	Screen::Screen( const String& screenName, const FVector2& initialSize, Viewport* viewport ) {
+		_addObjectKind( KIND_SCREEN );
 		if ( gScreen_ObjectAccessorList.getParent() == 0 )
 			gScreen_ObjectAccessorList.setParent( Object::getAccessors() );
 
@@ -133,6 +136,23 @@ namespace OpenGUI {
 		m_CursorFocus = 0; // start with no cursor focused widget
 		m_KeyFocus = 0; // start with no keyboard focused widget
 
+		mLayoutPending = false; // nothing to lay out yet
+		mDamageAll = true; // nothing has been drawn yet
+		mDamaged = false;
+		mDamage = FRect( 0.0f, 0.0f, 0.0f, 0.0f );
+		mCursorDamage = FRect( 0.0f, 0.0f, 0.0f, 0.0f );
+		mCursorChanged = true;
+		mCursorTargetValid = false;
+		mCursorOverlay = true;
+		mSceneBrush = 0;
+		mDrawArea = FRect( 0.0f, 0.0f, 0.0f, 0.0f );
+		mDrawPartial = false;
+		mRecordBuffer = 0;
+		mDrawOverlay = false;
+		mDrawScene = false;
+		mWakeupPending = false; // no Widget has asked to be woken
+		mWakeupTime = 0;
+
 		mStatUpdateTimer = TimerManager::getSingleton().getTimer();
 
 		mAutoUpdating = true; // we auto update by default
@@ -155,7 +175,9 @@ namespace OpenGUI {
 		_setKeyFocus( 0 );
 		_setCursorFocus( 0 );
 		setViewport( 0 ); // release from the current viewport, if there is one
-		/**/
+		if ( mSceneBrush )
+			delete mSceneBrush;
+		mSceneBrush = 0;
 	}
 	//############################################################################
 	Widget* Screen::getKeyFocusedWidget() {
@@ -192,6 +214,14 @@ namespace OpenGUI {
 
 		//notify previous of focus lost
 		if ( prev ) {
+			// While it held focus, the previous holder was sent moves directly rather than
+			// through its containers, so they have to be told to include it in the next move.
+			Widget* tracked = prev;
+			while ( tracked && tracked->getContainer() ) {
+				WidgetCollection* container = tracked->getContainer();
+				container->_trackCursor( tracked );
+				tracked = Widget::_cast( container->getParent() );
+			}
 			prev->_injectCursorFocusLost( next, prev );
 		}
 
@@ -267,6 +297,11 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Screen::invalidateAll() {
+		mDamageAll = true;
+		if ( mSceneBrush ) { // may be the wrong size now
+			delete mSceneBrush;
+			mSceneBrush = 0;
+		}
 		WidgetCollection::iterator iter = Children.begin();
 		while ( iter != Children.end() ) {
 			iter->flush();
@@ -277,13 +312,22 @@ namespace OpenGUI {
 	/*! If the Screen is not marked active, or does not have a valid Viewport assigned,
 	this function will return immediately with no error. */
 	void Screen::update() {
-		if ( !_isRenderable() )
-			return; //abort if we are unsuitable for drawing for any reason
+		if ( _prepareUpdate() ) {
+			_record();
+			_submit();
+		}
+	}
+	//############################################################################
+	/*! Processes input and layouts, and decides what the update will draw. This is
+	everything that may affect other Screens or call into the application outside of
+	a Draw event, so it always runs on the thread calling ScreenManager::updateScreens().
+	Returns \c false if there is nothing to record. */
+	bool Screen::_prepareUpdate() {
+		injectQueuedInput(); // input is processed even if we cannot draw
+		_resolveLayouts(); // settle geometry changed by input or since the last frame
 
-		Renderer& renderer = Renderer::getSingleton();
-		renderer.selectViewport( mViewport ); // inform renderer of new viewport selection
-		renderer.preRenderSetup(); // begin render sequence
-		mViewport->preUpdate( this ); // inform the viewport that it is about to be updated
+		if ( !_isRenderable() )
+			return false; //abort if we are unsuitable for drawing for any reason
 
 		// if pixel alignment changed since last render...
 		if ( mPrevViewportSize != mViewport->getSize() ) {
@@ -292,49 +336,164 @@ namespace OpenGUI {
 			mPrevViewportSize = mViewport->getSize(); //keep this for next render
 		}
 
-		ScreenBrush b( this, mViewport );
+		// with nothing changed, what the viewport kept from the previous update is still correct
+		if ( !needsRedraw() && _canUpdatePartially() ) {
+			mStatDamagedArea.addRecord( 0.0f );
+			_finishUpdate();
+			return false;
+		}
 
-		WidgetCollection::reverse_iterator iter, iterend = Children.rend();
-		for ( iter = Children.rbegin(); iter != iterend; iter++ ) {
-			iter->_draw( b );
+		mDrawCursor = _getDrawCursor();
+		// a viewport we can update partially only needs the area around the cursor redrawn when it moves,
+		// which is cheaper than keeping the scene texture up to date, so the overlay is not used there
+		mDrawOverlay = mDrawCursor && mCursorOverlay && !_canUpdatePartially()
+					   && TextureManager::getSingleton().supportsRenderToTexture();
+		mDrawScene = mDrawOverlay && ( mDamageAll || mDamaged || !mSceneBrush ); // before the cursor adds its own damage
+		if ( !mDrawOverlay && mSceneBrush ) {
+			delete mSceneBrush; // give the texture back until the cursor needs it again
+			mSceneBrush = 0;
 		}
-		if ( m_CursorEnabled && m_CursorVisible ) {
-			// determine the cursor we're drawing
-			CursorPtr drawCursor;
-			Widget* overWidget = getWidgetAt( mCursorPos, true );
-			if ( overWidget ) {
-				Control* overControl = dynamic_cast<Control*>( overWidget );
-				if ( overControl ) {
-					drawCursor = overControl->_getCurrentCursor();
-				}
-			}
-			if ( !drawCursor )
-				drawCursor = mDefaultCursor;
-
-			// send notifications if necessary
-			if ( drawCursor != mPrevCursor ) {
-				if ( mPrevCursor )
-					mPrevCursor->eventCursorHidden();
-				mPrevCursor = drawCursor;
-				if ( mPrevCursor )
-					mPrevCursor->eventCursorShown( mCursorPos.x, mCursorPos.y );
+
+		// whenever the cursor moves or changes, erase it where it was and draw it where it is
+		if ( mCursorChanged || mDrawCursor != mPrevCursor ) {
+			_damage( mCursorDamage );
+			mCursorDamage = FRect( mCursorPos, mCursorPos );
+			if ( mDrawCursor ) {
+				const FVector2& cursorSize = mDrawCursor->getSize();
+				mCursorDamage = FRect( mCursorPos - cursorSize, mCursorPos + cursorSize );
+				_damage( mCursorDamage );
 			}
+		}
+		mCursorChanged = false;
 
-			// Draw the cursor
-			if ( drawCursor )
-				drawCursor->eventDraw( mCursorPos.x, mCursorPos.y, b );
+		// decide how much of the Screen we are redrawing
+		mDrawPartial = !mDamageAll && _canUpdatePartially();
+		mDrawArea = FRect( 0.0f, 0.0f, mSize.x, mSize.y );
+		if ( mDrawPartial ) {
+			if ( mDamaged ) {
+				mDrawArea.min.x = mDamage.min.x > 0.0f ? mDamage.min.x : 0.0f;
+				mDrawArea.min.y = mDamage.min.y > 0.0f ? mDamage.min.y : 0.0f;
+				mDrawArea.max.x = mDamage.max.x < mSize.x ? mDamage.max.x : mSize.x;
+				mDrawArea.max.y = mDamage.max.y < mSize.y ? mDamage.max.y : mSize.y;
+				if ( mDrawArea.max.x < mDrawArea.min.x ) mDrawArea.max.x = mDrawArea.min.x;
+				if ( mDrawArea.max.y < mDrawArea.min.y ) mDrawArea.max.y = mDrawArea.min.y;
+			} else
+				mDrawArea = FRect( 0.0f, 0.0f, 0.0f, 0.0f );
 		}
+		mStatDamagedArea.addRecord(( mDrawArea.getWidth() * mDrawArea.getHeight() ) / ( mSize.x * mSize.y ) );
+		mDamaged = false;
+		mDamageAll = false;
 
+		// send cursor notifications if necessary
+		if ( m_CursorEnabled && m_CursorVisible && mDrawCursor != mPrevCursor ) {
+			if ( mPrevCursor )
+				mPrevCursor->eventCursorHidden();
+			mPrevCursor = mDrawCursor;
+			if ( mPrevCursor )
+				mPrevCursor->eventCursorShown( mCursorPos.x, mCursorPos.y );
+		}
+		return true;
+	}
+	//############################################################################
+	/*! Draws what _prepareUpdate() decided on into the RenderCommandBuffer of this
+	Screen. Nothing here calls the Renderer, so ScreenManager may record several
+	Screens at once on different threads.
+
+	When the cursor is drawn as an overlay, the Widgets are drawn into mSceneBrush
+	only when something in it was damaged. The scene is then copied to the viewport,
+	and the cursor is drawn over it. */
+	void Screen::_record() {
+		RenderCommandBuffer& buffer = _getCommandBuffer();
+		try {
+			buffer.beginViewport( mViewport, this, FRect( mDrawArea.min.x / mSize.x, mDrawArea.min.y / mSize.y,
+								  mDrawArea.max.x / mSize.x, mDrawArea.max.y / mSize.y ) );
+			if ( mDrawScene ) {
+				// the scene texture is cleared, so it must be drawn in full
+				if ( !mSceneBrush )
+					mSceneBrush = new Brush_RTT( this, mSize );
+				mSceneBrush->clear();
+				WidgetCollection::reverse_iterator iter, iterend = Children.rend();
+				for ( iter = Children.rbegin(); iter != iterend; iter++ )
+					iter->_draw( *mSceneBrush );
+			}
 
-		mViewport->postUpdate( this ); // inform the viewport that it is done being updated
-		renderer.postRenderCleanup(); // end render sequence
+			ScreenBrush b( this, mViewport );
+			if ( mDrawPartial )
+				b.pushClippingRect( mDrawArea );
 
+			if ( mDrawOverlay ) {
+				mSceneBrush->emerge( b );
+			} else {
+				WidgetCollection::reverse_iterator iter, iterend = Children.rend();
+				for ( iter = Children.rbegin(); iter != iterend; iter++ ) {
+					if ( mDrawPartial ) {
+						FRect bounds;
+						if ( iter->_getHitBounds( bounds ) && !bounds.intersects( mDrawArea ) )
+							continue; // untouched, so what we drew last time is still there
+					}
+					iter->_draw( b );
+				}
+			}
+			if ( mDrawCursor )
+				mDrawCursor->eventDraw( mCursorPos.x, mCursorPos.y, b );
+			if ( mDrawPartial )
+				b.pop();
+			buffer.endViewport();
+		} catch ( ... ) {
+			buffer.clear(); // never submit half of a frame
+			mDrawCursor = CursorPtr();
+			throw;
+		}
+		mDrawCursor = CursorPtr(); // no need to hold on to it until the next update
+	}
+	//############################################################################
+	/*! Sends the recorded commands to the Renderer, which must be done on the thread
+	that renders. */
+	void Screen::_submit() {
+		RenderCommandBuffer& buffer = _getCommandBuffer();
+		try {
+			buffer.submit();
+		} catch ( ... ) {
+			buffer.clear();
+			throw;
+		}
+		buffer.clear();
+		_finishUpdate();
+	}
+	//############################################################################
+	/*! The buffer returned holds a complete update of this Screen, and can be submitted
+	by any thread that renders. Further updates are recorded into the other buffer, so the
+	returned buffer must be submitted and cleared before the next one is swapped out. */
+	RenderCommandBuffer* Screen::_swapCommandBuffers() {
+		RenderCommandBuffer* recorded = &_getCommandBuffer();
+		mRecordBuffer = 1 - mRecordBuffer;
+		return recorded;
+	}
+	//############################################################################
+	void Screen::_finishUpdate() {
 		//! \todo timing here is broken. #100
 		float time = (( float )mStatUpdateTimer->getMilliseconds() ) / 1000.0f;
 		_updateStats_UpdateTime( time );
 		mStatUpdateTimer->reset();
 	}
 	//############################################################################
+	/*! The Widget under the cursor can only change when the cursor moves or changes,
+	or when a Widget is damaged, so the result of the hit test is kept until then. */
+	CursorPtr Screen::_getDrawCursor() {
+		if ( !m_CursorEnabled || !m_CursorVisible )
+			return CursorPtr();
+		if ( !mCursorTargetValid || mCursorChanged ) {
+			mCursorTarget = CursorPtr();
+			Control* overControl = Control::_cast( getWidgetAt( mCursorPos, true ) );
+			if ( overControl )
+				mCursorTarget = overControl->_getCurrentCursor();
+			mCursorTargetValid = true;
+		}
+		if ( mCursorTarget )
+			return mCursorTarget;
+		return mDefaultCursor;
+	}
+	//############################################################################
 	void Screen::injectTime( unsigned int milliseconds ) {
 		float seconds;
 		seconds = (( float )milliseconds ) / 1000.0f;
@@ -342,6 +501,8 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Screen::injectTime( float seconds ) {
+		if ( mWakeupPending && TimerManager::getSingleton().getMillisecondsSinceStart() >= mWakeupTime )
+			mWakeupPending = false; // delivered by this tick, Widgets that need more can ask again
 		WidgetCollection::iterator iter = Children.begin();
 		while ( iter != Children.end() ) {
 			iter->_tick( seconds );
@@ -349,6 +510,183 @@ namespace OpenGUI {
 		}
 	}
 	//############################################################################
+	void Screen::_queueInput( QueuedInput::Type type ) {
+		QueuedInput input;
+		input.type = type;
+		input.pressed = false;
+		input.character = 0;
+		input.seconds = 0.0f;
+		mInputQueue.push_back( input );
+	}
+	//############################################################################
+	void Screen::queueCursorMovement( float x_rel, float y_rel ) {
+		// relative to the most recently queued position, as that is where the cursor will be by then
+		FVector2 base = mCursorPos;
+		for ( InputQueue::reverse_iterator iter = mInputQueue.rbegin(); iter != mInputQueue.rend(); iter++ ) {
+			if ( iter->type == QueuedInput::CURSOR_POSITION ) {
+				base = iter->position;
+				break;
+			}
+		}
+		queueCursorPosition( base.x + x_rel, base.y + y_rel );
+	}
+	//############################################################################
+	/*! If the last queued entry is also a cursor position, it is replaced rather
+	than adding a new entry. */
+	void Screen::queueCursorPosition( float x_pos, float y_pos ) {
+		if ( mInputQueue.empty() || mInputQueue.back().type != QueuedInput::CURSOR_POSITION )
+			_queueInput( QueuedInput::CURSOR_POSITION );
+		mInputQueue.back().position = FVector2( x_pos, y_pos );
+	}
+	//############################################################################
+	void Screen::queueCursorPosition_Percent( float x_perc, float y_perc ) {
+		queueCursorPosition( x_perc * mSize.x, y_perc * mSize.y );
+	}
+	//############################################################################
+	void Screen::queueCursorPress() {
+		_queueInput( QueuedInput::CURSOR_PRESS );
+	}
+	//############################################################################
+	void Screen::queueCursorRelease() {
+		_queueInput( QueuedInput::CURSOR_RELEASE );
+	}
+	//############################################################################
+	void Screen::queueCursorPress_State( bool pressed ) {
+		_queueInput( QueuedInput::CURSOR_PRESS_STATE );
+		mInputQueue.back().pressed = pressed;
+	}
+	//############################################################################
+	void Screen::queueCharacter( char character ) {
+		_queueInput( QueuedInput::CHARACTER );
+		mInputQueue.back().character = character;
+	}
+	//############################################################################
+	void Screen::queueTime( unsigned int milliseconds ) {
+		queueTime((( float )milliseconds ) / 1000.0f );
+	}
+	//############################################################################
+	/*! If the last queued entry is also time, this is added to it rather than
+	adding a new entry. */
+	void Screen::queueTime( float seconds ) {
+		if ( mInputQueue.empty() || mInputQueue.back().type != QueuedInput::TIME )
+			_queueInput( QueuedInput::TIME );
+		mInputQueue.back().seconds += seconds;
+	}
+	//############################################################################
+	size_t Screen::getQueuedInputCount() const {
+		return mInputQueue.size();
+	}
+	//############################################################################
+	/*! This is \c true when Widgets have been invalidated, moved, added or removed, when the
+	cursor has moved or changed, or when there is queued input or a pending layout update.
+
+	Screens drawing into a Viewport that keeps its contents (see Viewport::retainsContents())
+	skip drawing entirely in update() while this is \c false, so calling update() is cheap.
+	Hosts that present their own back buffer can use this to skip frames altogether, and
+	getNextWakeup() to know how long they can sleep. */
+	bool Screen::needsRedraw() {
+		return mDamageAll || mDamaged || mCursorChanged || mLayoutPending || !mInputQueue.empty();
+	}
+	//############################################################################
+	/*! Widgets that animate over time should call this from their Tick handler for as
+	long as they are animating, with the time until their next visual change. Only the
+	soonest request is kept, and it is cleared by the first injectTime() after it is due. */
+	void Screen::scheduleWakeup( float seconds ) {
+		if ( seconds < 0.0f ) seconds = 0.0f;
+		unsigned long when = TimerManager::getSingleton().getMillisecondsSinceStart()
+							 + ( unsigned long )( seconds * 1000.0f );
+		if ( !mWakeupPending || when < mWakeupTime ) {
+			mWakeupTime = when;
+			mWakeupPending = true;
+		}
+	}
+	//############################################################################
+	/*! Returns 0.0f if needsRedraw() is already \c true or a requested wake up is due,
+	and -1.0f if nothing is scheduled, in which case the host can sleep until it has input. */
+	float Screen::getNextWakeup() {
+		if ( needsRedraw() )
+			return 0.0f;
+		if ( !mWakeupPending )
+			return -1.0f;
+		unsigned long now = TimerManager::getSingleton().getMillisecondsSinceStart();
+		if ( now >= mWakeupTime )
+			return 0.0f;
+		return ( float )( mWakeupTime - now ) / 1000.0f;
+	}
+	//############################################################################
+	void Screen::_damage( const FRect& area ) {
+		mCursorTargetValid = false;
+		if ( mDamageAll || area.getWidth() <= 0.0f || area.getHeight() <= 0.0f )
+			return;
+		if ( mDamaged )
+			mDamage.merge( area );
+		else
+			mDamage = area;
+		mDamaged = true;
+	}
+	//############################################################################
+	void Screen::_damageAll() {
+		mCursorTargetValid = false;
+		mDamageAll = true;
+	}
+	//############################################################################
+	/*! Partial updates draw over the previous frame, so the Viewport must keep it, and
+	no other Screen can be drawing into the same Viewport. */
+	bool Screen::_canUpdatePartially() {
+		return mViewport && mViewport->retainsContents() && mViewport->getScreenSet().size() == 1;
+	}
+	//############################################################################
+	void Screen::_queueLayout() {
+		mLayoutPending = true;
+	}
+	//############################################################################
+	void Screen::_resolveLayouts() {
+		if ( !mLayoutPending )
+			return;
+		mLayoutPending = false;
+		WidgetCollection::iterator iter, iterend = Children.end();
+		for ( iter = Children.begin(); iter != iterend; iter++ ) {
+			ContainerControl* container = ContainerControl::_cast( iter.get() );
+			if ( container )
+				container->_resolveLayout();
+		}
+	}
+	//############################################################################
+	/*! Anything queued by the event handlers run from here is left for the next call. */
+	void Screen::injectQueuedInput() {
+		if ( mInputQueue.empty() )
+			return;
+		mInputProcessing.swap( mInputQueue );
+		try {
+			for ( InputQueue::iterator iter = mInputProcessing.begin(); iter != mInputProcessing.end(); iter++ ) {
+				switch ( iter->type ) {
+				case QueuedInput::CURSOR_POSITION:
+					injectCursorPosition( iter->position.x, iter->position.y );
+					break;
+				case QueuedInput::CURSOR_PRESS:
+					injectCursorPress();
+					break;
+				case QueuedInput::CURSOR_RELEASE:
+					injectCursorRelease();
+					break;
+				case QueuedInput::CURSOR_PRESS_STATE:
+					injectCursorPress_State( iter->pressed );
+					break;
+				case QueuedInput::CHARACTER:
+					injectCharacter( iter->character );
+					break;
+				case QueuedInput::TIME:
+					injectTime( iter->seconds );
+					break;
+				}
+			}
+		} catch ( ... ) {
+			mInputProcessing.clear();
+			throw;
+		}
+		mInputProcessing.clear();
+	}
+	//############################################################################
 	/*!
 	\note this is a temporary implementation that will be replaced with a more useful system
 	\todo finish me
@@ -403,12 +741,15 @@ namespace OpenGUI {
 		//store the new cursor position for future use
 		mCursorPos.x = x_pos;
 		mCursorPos.y = y_pos;
+		mCursorChanged = true;
 
 		//send to the active cursor, if we have one
 		if ( mPrevCursor ) {
 			mPrevCursor->eventCursorMove( mCursorPos.x, mCursorPos.y );
 		}
 
+		const unsigned int dispatchStart = WidgetCollection::_getCursorDispatchCount();
+
 		//send to just focus holder if present
 		if ( m_CursorFocus ) {
 			FVector2 localPos( x_pos, y_pos );
@@ -416,16 +757,16 @@ namespace OpenGUI {
 			Cursor_EventArgs moveEvent( localPos.x, localPos.y );
 			if ( preConsumed ) moveEvent.eat();
 			m_CursorFocus->_injectCursorMove( moveEvent );
+			// +1 for the focus holder, which was not sent the move by a collection
+			mStatCursorDispatch.addRecord(( float )( WidgetCollection::_getCursorDispatchCount() - dispatchStart + 1 ) );
 			return true; // see end of function note
 		}
 
-		//send to everyone
+		//send to the widgets under the cursor, and those that need to see it leave
 		Cursor_EventArgs moveEvent( x_pos, y_pos );
 		if ( preConsumed ) moveEvent.eat();
-		WidgetCollection::iterator i, ie = Children.end();
-		for ( i = Children.begin(); i != ie; i++ ) {
-			i->_injectCursorMove( moveEvent );
-		}
+		Children._injectCursorMove( moveEvent );
+		mStatCursorDispatch.addRecord(( float )( WidgetCollection::_getCursorDispatchCount() - dispatchStart ) );
 
 		// we always return true if the move was issued to the widgets, regardless if anyone consumed it
 		// (merely processing it signifies that it was useful)
@@ -458,12 +799,9 @@ namespace OpenGUI {
 			return pressEvent.Consumed; // return the consumption value
 		}
 
-		//send to everyone else
+		//send to the widgets under the cursor
 		Cursor_EventArgs pressEvent( mCursorPos.x, mCursorPos.y );
-		WidgetCollection::iterator i, ie = Children.end();
-		for ( i = Children.begin(); i != ie; i++ ) {
-			i->_injectCursorPress( pressEvent );
-		}
+		Children._injectCursorPress( pressEvent );
 
 		return pressEvent.Consumed; // return the consumption value
 	}
@@ -486,12 +824,9 @@ namespace OpenGUI {
 			return releaseEvent.Consumed; // return the consumption value
 		}
 
-		//send to everyone else
+		//send to the widgets under the cursor
 		Cursor_EventArgs releaseEvent( mCursorPos.x, mCursorPos.y );
-		WidgetCollection::iterator i, ie = Children.end();
-		for ( i = Children.begin(); i != ie; i++ ) {
-			i->_injectCursorRelease( releaseEvent );
-		}
+		Children._injectCursorRelease( releaseEvent );
 
 		return releaseEvent.Consumed; // return the consumption value
 	}
@@ -515,6 +850,7 @@ namespace OpenGUI {
 	void Screen::enableCursor() {
 		if ( !m_CursorEnabled ) {
 			m_CursorEnabled = true;
+			mCursorChanged = true;
 			if ( mDefaultCursor.isNull() && cursorVisible() ) {
 				hideCursor();
 			}
@@ -532,6 +868,7 @@ namespace OpenGUI {
 				mPrevCursor = 0;
 			}
 			m_CursorEnabled = false;
+			mCursorChanged = true;
 
 			// clear any existing cursor focus, but don't issue the state updating move event
 			_setCursorFocus( 0, false );
@@ -555,12 +892,14 @@ namespace OpenGUI {
 		if ( cursorEnabled() && mDefaultCursor.isNull() )
 			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Cannot show enabled cursor on Screen without a default cursor", __FUNCTION__ );
 		m_CursorVisible = true;
+		mCursorChanged = true;
 	}
 	//############################################################################
 	/*! Multiple calls have no ill effect. */
 	void Screen::hideCursor() {
 		if ( m_CursorVisible ) {
 			m_CursorVisible = false;
+			mCursorChanged = true;
 			if ( mPrevCursor ) {
 				mPrevCursor->eventCursorHidden();
 				mPrevCursor = 0;
@@ -579,33 +918,38 @@ namespace OpenGUI {
 			hideCursor();
 		}
 		mDefaultCursor = cursor;
+		mCursorChanged = true;
+	}
+	//############################################################################
+	void Screen::setCursorOverlay( bool overlay ) {
+		if ( mCursorOverlay == overlay ) return;
+		mCursorOverlay = overlay;
+		mDamageAll = true; // the viewport must be drawn in full by whichever path is taken next
+	}
+	//############################################################################
+	bool Screen::getCursorOverlay() {
+		return mCursorOverlay;
 	}
 	//############################################################################
 	Widget* Screen::getWidgetAt( const FVector2& position, bool recursive ) {
-		for ( WidgetCollection::iterator iter = Children.begin();iter != Children.end(); iter++ ) {
-			Widget* child = iter.get();
-			if ( child->isInside( position ) ) {
-				Widget* ret = child;
-				if ( recursive ) {
-					child = child->getChildAt( position, true );
-					if ( child )
-						ret = child;
-				}
-				return ret;
-			}
+		Widget* ret = Children.getWidgetAt( position );
+		if ( ret && recursive ) {
+			Widget* child = ret->getChildAt( position, true );
+			if ( child )
+				ret = child;
 		}
-		return 0;
+		return ret;
 	}
 	//############################################################################
 	void Screen::getWidgetsAt( const FVector2& position, WidgetPtrList& outList, bool recursive ) {
-		for ( WidgetCollection::iterator iter = Children.begin(); iter != Children.end(); iter++ ) {
-			Widget* child = iter.get();
-			if ( child->isInside( position ) ) {
-				if ( recursive ) {
-					child->getChildrenAt( position, outList, true );
-				}
-				outList.push_back( child );
+		WidgetPtrList hits;
+		Children.getWidgetsAt( position, hits );
+		for ( WidgetPtrList::iterator iter = hits.begin(); iter != hits.end(); iter++ ) {
+			Widget* child = ( *iter );
+			if ( recursive ) {
+				child->getChildrenAt( position, outList, true );
 			}
+			outList.push_back( child );
 		}
 	}
 	//############################################################################
@@ -622,36 +966,51 @@ namespace OpenGUI {
 		mStatUpdate.reset();
 	}
 	//############################################################################
+	/*! Counts every widget that the move was delivered to, at every level of the
+	hierarchy. */
+	float Screen::statsGetCursorDispatch() {
+		return mStatCursorDispatch.getAverage();
+	}
+	//############################################################################
+	void Screen::statsResetCursorDispatch() {
+		mStatCursorDispatch.reset();
+	}
+	//############################################################################
+	float Screen::statsGetDamagedArea() {
+		return mStatDamagedArea.getAverage();
+	}
+	//############################################################################
+	void Screen::statsResetDamagedArea() {
+		mStatDamagedArea.reset();
+	}
+	//############################################################################
 	/*! \see Widget::getPath() for a more in-depth explanation of paths */
 	Widget* Screen::getPath( const String& path ) const {
 		String tmpPath = path;
 		StrConv::trim( tmpPath );
+		if ( tmpPath.length() == 0 )
+			return _getPath( tmpPath, String::npos );
 
-		StringList pathList;
-		StrConv::tokenize( tmpPath, pathList, '/' );
-		if ( pathList.front() == "" ) {
-			//this was a request for an absolute path
-			//so just pop off the first entry and continue
-			pathList.pop_front();
-		}
-		return _getPath( pathList );
+		//a leading slash marks an absolute path, which is where we already are
+		return _getPath( tmpPath, tmpPath.at( 0 ) == '/' ? 1 : 0 );
 	}
 	//############################################################################
-	Widget* Screen::_getPath( StringList& pathList ) const {
-		if ( pathList.size() == 0 ) {
+	Widget* Screen::_getPath( const String& path, String::size_type start ) const {
+		if ( start == String::npos ) {
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Paths cannot resolve to Screen objects", __FUNCTION__ );
 			return 0;
 		}
 
-		const String top = pathList.front();
-		pathList.pop_front();
+		const String::size_type end = path.find( '/', start );
+		const String top = path.substr( start, end == String::npos ? String::npos : end - start );
+		const String::size_type next = end == String::npos ? String::npos : end + 1;
 		if ( !( top.length() > 0 ) ) {
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Empty path locations are not allowed", __FUNCTION__ );
 			return 0;
 		}
 
 		if ( top == "." ) {
-			return _getPath( pathList );
+			return _getPath( path, next );
 		}
 
 		if ( top == ".." ) {
@@ -661,7 +1020,7 @@ namespace OpenGUI {
 
 		Widget* child = Children.getWidget( top );
 		if ( child ) {
-			return child->_getPath( pathList );
+			return child->_getPath( path, next );
 		}
 		return 0;
 	}
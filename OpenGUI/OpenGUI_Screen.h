@@ -16,10 +16,12 @@
 #include "OpenGUI_Cursor.h"
 #include "OpenGUI_Statistic.h"
 #include "OpenGUI_Timer.h"
+#include "OpenGUI_RenderCommandBuffer.h"
 
 namespace OpenGUI {
 	class ScreenManager;
 	class Viewport;
+	class Brush_RTT;
 
 	//! Every GUI is built into a screen.
 	/*! Screens are the base of every GUI display, and it's often best to think
@@ -37,6 +39,7 @@ namespace OpenGUI {
 	*/
 	class OPENGUI_API Screen : public Object {
 		friend class ScreenManager; //Allow ScreenManager to create and destroy us
+		friend class ScreenRecordJob; //ScreenManager's worker threads call _record()
 	public:
 //!\name Cursor Functions (Input Injection & Utility)
 //@{
@@ -74,6 +77,19 @@ namespace OpenGUI {
 		void hideCursor();
 		//! Returns \c true if the cursor is shown, \c false if it is hidden.
 		bool cursorVisible();
+		//! Sets if the cursor is drawn as an overlay on a stored copy of the Screen. Default is \c true
+		/*! When enabled and the Renderer supports render textures, everything but the cursor is drawn
+		to a render texture the size of the Screen, and only redrawn when something in it changes.
+		Each update() then draws that texture and the cursor over it, so moving the cursor costs a
+		quad instead of drawing every Widget again. The texture is released while the cursor is
+		hidden or disabled.
+
+		The overlay is not used for a Screen that can be updated partially, as described in
+		Viewport::retainsContents(), since moving the cursor then only redraws the Widgets
+		around it, and any other change only redraws the Widgets it touched. */
+		void setCursorOverlay( bool overlay );
+		//! Returns \c true if the cursor is drawn as an overlay. \see setCursorOverlay()
+		bool getCursorOverlay();
 		//! Returns a pointer to the current Widget that has cursor focus, or 0 if none
 		Widget* getCursorFocusedWidget();
 
@@ -113,6 +129,41 @@ namespace OpenGUI {
 		void injectTime( float seconds );
 //@}
 
+//!\name Buffered Input
+/*! These queue input to be injected at the start of the next update(), rather than
+injecting it immediately. Consecutive cursor positions are coalesced into the last
+one, and consecutive time injections into their sum, so the cost of input per frame
+stays bounded no matter how often the host application samples its devices. Everything
+else is injected in the order it was queued, so presses and releases still happen
+at the cursor position they were queued after.
+
+Queued input is subject to the same rules as direct injection when it is processed,
+so cursor input is ignored if the cursor is disabled at that time. */
+//@{
+		//! Queues cursor movement relative to the last queued (or current) cursor position
+		void queueCursorMovement( float x_rel, float y_rel );
+		//! Queues an absolute cursor position on the screen
+		void queueCursorPosition( float x_pos, float y_pos );
+		//! Queues an absolute cursor position as a percentage of the screen
+		void queueCursorPosition_Percent( float x_perc, float y_perc );
+		//! Queues a cursor press
+		void queueCursorPress();
+		//! Queues a cursor release
+		void queueCursorRelease();
+		//! Queues a cursor press/release, using the built in state logic of injectCursorPress_State() when processed
+		void queueCursorPress_State( bool pressed );
+		//! Queues the given \c character as text input from the user
+		void queueCharacter( char character );
+		//! Queues time, in milliseconds ( 1/1000th of a second )
+		void queueTime( unsigned int milliseconds );
+		//! Queues time as a float value of a whole second
+		void queueTime( float seconds );
+		//! Injects all queued input immediately. Called automatically at the start of update()
+		void injectQueuedInput();
+		//! Returns the number of queued input entries, after coalescing
+		size_t getQueuedInputCount() const;
+//@}
+
 		//! Returns a pointer to the topmost Widget at the given location, or 0 (NULL) if no match found
 		Widget* getWidgetAt( const FVector2& position, bool recursive = false );
 		//! Returns a list of all widgets at the given location, sorted by depth from top to bottom
@@ -120,8 +171,8 @@ namespace OpenGUI {
 
 		//! Returns a pointer to the widget at the given path, 0 if no widget is found
 		Widget* getPath( const String& path ) const;
-		//! \internal follows the given \c pathList, returning the ending location. The \c pathList is modified along the way
-		Widget* _getPath( StringList& pathList ) const;
+		//! \internal follows the remainder of \c path from the segment starting at \c start, returning the ending location. \c start is String::npos when no segments remain
+		Widget* _getPath( const String& path, String::size_type start ) const;
 
 
 		//! returns the name of this Screen
@@ -183,10 +234,27 @@ namespace OpenGUI {
 		//! Invalidates all contained Widgets, causing a complete redraw on next update()
 		void invalidateAll();
 
+		//! Returns \c true if anything has changed that the next update() needs to draw
+		bool needsRedraw();
+		//! Asks that the host update this Screen, with time injected, within the given number of \c seconds
+		void scheduleWakeup( float seconds );
+		//! Returns the seconds until this Screen needs to be updated, or -1.0f if it does not until something changes
+		float getNextWakeup();
+
 		//! Returns the time spent performing Screen::update(), averaged over the past 5 frames.
 		float statsGetUpdateTime();
 		//! Resets the UpdateTime statistic
 		void statsResetUpdateTime();
+		//! Returns the number of widgets each cursor move was delivered to, averaged over the past 5 moves.
+		float statsGetCursorDispatch();
+		//! Resets the CursorDispatch statistic
+		void statsResetCursorDispatch();
+		//! Returns the fraction of the Screen area redrawn by each update(), averaged over the past 5 frames.
+		/*! This is always 1.0f unless the Viewport retains its contents (see Viewport::retainsContents()),
+		in which case only the areas covered by Widgets that changed are redrawn. */
+		float statsGetDamagedArea();
+		//! Resets the DamagedArea statistic
+		void statsResetDamagedArea();
 
 		//! Sets this screen active or disabled according to the given \c active flag
 		void setActive( bool active );
@@ -195,6 +263,20 @@ namespace OpenGUI {
 
 		//! \internal returns \c true if this Screen is both active and has a valid Viewport set
 		bool _isRenderable();
+		//! \internal Notifies the Screen that a ContainerControl within it has queued a layout update
+		void _queueLayout();
+		//! \internal Adds the given \c area, in Screen units, to the area redrawn by the next update()
+		void _damage( const FRect& area );
+		//! \internal Causes the next update() to redraw the entire Screen
+		void _damageAll();
+		//! \internal Returns \c true if _damage() reports are still needed, which they are not once the entire Screen is to be redrawn
+		bool _isTrackingDamage() const {
+			return !mDamageAll;
+		}
+		//! \internal Returns the command buffer that Brushes drawing to this Screen record into
+		RenderCommandBuffer& _getCommandBuffer() {
+			return mCommandBuffers[mRecordBuffer];
+		}
 
 		//! The public collection of child widgets
 		WidgetCollection Children;
@@ -202,6 +284,10 @@ namespace OpenGUI {
 		// inherited from Object, used to provide properties
 		virtual ObjectAccessorList* getAccessors();
 		virtual unsigned int getObjectType() const;
+		//! Returns \c object as a Screen, or 0 if it is not one. Equivalent to, but much cheaper than, \c dynamic_cast<Screen*>
+		static Screen* _cast( Object* object ) {
+			return object && object->isKindOf( KIND_SCREEN ) ? static_cast<Screen*>( object ) : 0;
+		}
 
 	protected:
 		// We aren't for creation outside of ScreenManager
@@ -241,6 +327,62 @@ namespace OpenGUI {
 		CursorPtr mDefaultCursor; // the default cursor for this Screen
 		CursorPtr mPrevCursor; // the cursor drawn in the previous render
 
+		//buffered input
+		struct QueuedInput {
+			enum Type {
+				CURSOR_POSITION,
+				CURSOR_PRESS,
+				CURSOR_RELEASE,
+				CURSOR_PRESS_STATE,
+				CHARACTER,
+				TIME
+			} type;
+			FVector2 position; // CURSOR_POSITION
+			bool pressed; // CURSOR_PRESS_STATE
+			char character; // CHARACTER
+			float seconds; // TIME
+		};
+		typedef std::vector<QueuedInput> InputQueue;
+		InputQueue mInputQueue; // input waiting for the next update()
+		InputQueue mInputProcessing; // input being injected, swapped with mInputQueue so both keep their allocations
+		void _queueInput( QueuedInput::Type type );
+
+		bool mLayoutPending; // a contained ContainerControl has queued a layout update
+		void _resolveLayouts(); // performs all queued layout updates, top-down
+
+		//partial redraw
+		bool mDamageAll; // the next update() redraws the entire Screen
+		bool mDamaged; // mDamage holds an area that the next update() must redraw
+		FRect mDamage; // bounds of all damage since the previous update()
+		FRect mCursorDamage; // area covered by the cursor drawn in the previous update()
+		bool _canUpdatePartially(); // true if the viewport keeps what we drew last time
+		bool mCursorChanged; // the cursor moved, changed, or was shown or hidden since the previous update()
+
+		//update phases, split so that ScreenManager can record several Screens at once, and submit them from another thread
+		bool _prepareUpdate(); // input, layout, and deciding what to draw. false if there is nothing to draw
+		void _record(); // draws into _getCommandBuffer(), touching nothing outside of this Screen
+		void _submit(); // sends _getCommandBuffer() to the Renderer
+		void _finishUpdate(); // update statistics
+		RenderCommandBuffer* _swapCommandBuffers(); // returns the recorded buffer for someone else to submit, and records into the other
+		RenderCommandBuffer mCommandBuffers[2]; // output of _record(), one may wait to be submitted while the other is recorded
+		unsigned int mRecordBuffer; // index of the buffer that _record() draws into
+		FRect mDrawArea; // area being drawn by this update, in Screen units
+		bool mDrawPartial; // only mDrawArea is being drawn
+		bool mDrawOverlay; // the cursor is being drawn over mSceneBrush
+		bool mDrawScene; // mSceneBrush is being drawn again
+		CursorPtr mDrawCursor; // cursor being drawn, if any
+
+		//cursor overlay
+		CursorPtr _getDrawCursor(); // returns the cursor to draw, hit testing only when something has changed
+		CursorPtr mCursorTarget; // cursor of the Control found by the last hit test, if it has one
+		bool mCursorTargetValid; // mCursorTarget is still correct
+		bool mCursorOverlay; // draw the cursor over mSceneBrush when render textures are available
+		Brush_RTT* mSceneBrush; // everything but the cursor, as of the last update() that drew it
+
+		//idle
+		bool mWakeupPending; // a wake up has been requested by scheduleWakeup()
+		unsigned long mWakeupTime; // when the wake up is due, in TimerManager::getMillisecondsSinceStart() time
+
 		//Focus variables
 		Widget* m_CursorFocus; // pointer to current widget with cursor focus, 0 if none
 		Widget* m_KeyFocus; // pointer to current widget with keyboard focus, 0 if none
@@ -249,6 +391,8 @@ namespace OpenGUI {
 		TimerPtr mStatUpdateTimer;
 		AverageStat mStatUpdate;
 		void _updateStats_UpdateTime( float newTime ); // inserts a new update time data point
+		AverageStat mStatCursorDispatch;
+		AverageStat mStatDamagedArea;
 	};
 
 } //namespace OpenGUI{
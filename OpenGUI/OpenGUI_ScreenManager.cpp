@@ -13,8 +13,22 @@
 #include "OpenGUI_CursorManager.h"
 #include "OpenGUI_WidgetManager.h"
 #include "OpenGUI_FormManager.h"
+#include "OpenGUI_Renderer.h"
+#include "OpenGUI_TextureManager.h"
+#include "OpenGUI_Thread.h"
 
 namespace OpenGUI {
+	//############################################################################
+	//! Records the draw commands of one Screen, for ScreenManager::updateScreens() to run on its WorkerPool
+	class ScreenRecordJob: public WorkerPool::Job {
+	public:
+		ScreenRecordJob( Screen* screen ): mScreen( screen ) {}
+		virtual void run() {
+			mScreen->_record();
+		}
+	private:
+		Screen* mScreen;
+	};
 	//############################################################################
 	template<> ScreenManager* Singleton<ScreenManager>::mptr_Singleton = 0;
 	//############################################################################
@@ -34,6 +48,9 @@ namespace OpenGUI {
 		/**/
 		mTimer = TimerManager::getSingleton().getTimer();
 		mFPSTimer = TimerManager::getSingleton().getTimer();
+		mWorkerPool = 0;
+		mUploadBuffer = 0;
+		mFrameFree.post( 2 ); // one frame may wait to be submitted while the next is recorded
 
 		XMLParser::getSingleton().RegisterLoadHandler( "Screen", &ScreenManager::_Screen_XMLNode_Load );
 		XMLParser::getSingleton().RegisterUnloadHandler( "Screen", &ScreenManager::_Screen_XMLNode_Unload );
@@ -42,6 +59,7 @@ namespace OpenGUI {
 	ScreenManager::~ScreenManager() {
 		LogManager::SlogMsg( "SHUTDOWN", OGLL_INFO2 ) << "Destroying ScreenManager" << Log::endlog;
 		destroyAllScreens();
+		delete mWorkerPool;
 
 		XMLParser::getSingleton().UnregisterLoadHandler( "Screen", &ScreenManager::_Screen_XMLNode_Load );
 		XMLParser::getSingleton().UnregisterUnloadHandler( "Screen", &ScreenManager::_Screen_XMLNode_Unload );
@@ -68,6 +86,9 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_INTERNAL_ERROR,
 					  "Invalid Screen pointer", __FUNCTION__ );
 
+		// its command buffers cannot be left waiting for submitScreens()
+		_discardFrames( screenPtr );
+
 		// delete the screen, which will likely fire off some events
 		delete screenPtr;
 
@@ -85,15 +106,209 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void ScreenManager::updateScreens() {
-		for ( ScreenMap::iterator iter = mScreenMap.begin();
-				iter != mScreenMap.end(); iter++ ) {
-			Screen* screen = iter->second;
-			if ( screen->isAutoUpdating() )
-				screen->update();
+		if ( !mWorkerPool ) {
+			for ( ScreenMap::iterator iter = mScreenMap.begin();
+					iter != mScreenMap.end(); iter++ ) {
+				Screen* screen = iter->second;
+				if ( screen->isAutoUpdating() )
+					screen->update();
+			}
+			_stat_UpdateFPS();
+			return;
+		}
+
+		ScreenList drawList;
+		RenderCommandBuffer uploads;
+		try {
+			_recordScreens( drawList, uploads );
+		} catch ( ... ) {
+			uploads.submit(); // the font atlases already count on these
+			throw;
+		}
+
+		// the Renderer is only ever used from this thread
+		uploads.submit();
+		for ( ScreenList::iterator iter = drawList.begin(); iter != drawList.end(); iter++ )
+			( *iter )->_submit();
+		_stat_UpdateFPS();
+	}
+	//############################################################################
+	/*! Performs the same input injection, layout, and drawing as updateScreens(), but none
+	of the drawing Renderer calls. Each Screen that needed drawing records its update into a
+	command buffer, and the frame of buffers is queued for submitScreens(), which may be called
+	from another thread, such as the thread that owns the rendering context. This lets the next
+	frame's widget work overlap the submission of the previous frame.
+
+	Texture updates made while recording, such as glyphs added to a font atlas, are copied into
+	the frame and sent to the Renderer ahead of its Screens. Textures that are created, including
+	render textures, still go to the Renderer immediately.
+
+	Frames are double buffered. If two recorded frames are still waiting to be submitted,
+	this waits for submitScreens() to finish the older one before recording.
+
+	\note Submitting from another thread requires OpenGUI to be built with
+	\c OPENGUI_THREADED_UPDATE defined (see OpenGUI_CONFIG.h). While frames are being submitted
+	from another thread, the Renderer will have its texture functions called from this thread,
+	so it must also return \c true from Renderer::supportsThreadedTextures(). Screens that are in use by this pipeline should
+	not also be drawn with updateScreens() or Screen::update(), and Viewports must not be
+	destroyed while a recorded frame still refers to them. */
+	void ScreenManager::recordScreens() {
+		mFrameFree.wait();
+		ScreenList drawList;
+		RenderCommandBuffer& uploads = mUploadBuffers[mUploadBuffer];
+		try {
+			_recordScreens( drawList, uploads );
+		} catch ( ... ) {
+			mFrameFree.post(); // no frame was queued, any uploads go with the next one
+			throw;
+		}
+
+		Frame frame;
+		if ( !uploads.isEmpty() ) {
+			frame.push_back( &uploads );
+			mUploadBuffer = 1 - mUploadBuffer;
+		}
+		for ( ScreenList::iterator iter = drawList.begin(); iter != drawList.end(); iter++ ) {
+			( *iter )->_finishUpdate();
+			frame.push_back(( *iter )->_swapCommandBuffers() );
+		}
+		{
+			MutexLock lock( mFrameMutex );
+			mFrames.push_back( Frame() );
+			mFrames.back().swap( frame );
 		}
 		_stat_UpdateFPS();
 	}
 	//############################################################################
+	/*! This sends the oldest frame queued by recordScreens() to the Renderer, and may be
+	called from any single thread, which is then the only thread that renders. Each call
+	submits at most one frame, so that a render loop can present the frames at its own pace.
+	\return \c true if a frame was submitted, \c false if no frame was waiting */
+	bool ScreenManager::submitScreens() {
+		MutexLock submitLock( mSubmitMutex );
+		Frame frame;
+		{
+			MutexLock lock( mFrameMutex );
+			if ( mFrames.empty() )
+				return false;
+			frame.swap( mFrames.front() );
+			mFrames.pop_front();
+		}
+
+		try {
+			for ( Frame::iterator iter = frame.begin(); iter != frame.end(); iter++ ) {
+				( *iter )->submit();
+				( *iter )->clear();
+			}
+		} catch ( ... ) {
+			for ( Frame::iterator iter = frame.begin(); iter != frame.end(); iter++ )
+				( *iter )->clear();
+			mFrameFree.post();
+			throw;
+		}
+		mFrameFree.post();
+		return true;
+	}
+	//############################################################################
+	/*! Texture updates made along the way are recorded into \c uploads, which must be
+	submitted before the Screens in \c drawList. */
+	void ScreenManager::_recordScreens( ScreenList& drawList, RenderCommandBuffer& uploads ) {
+		TextureManager& texMgr = TextureManager::getSingleton();
+		texMgr._setUploadBuffer( &uploads );
+		try {
+			// input and layout can reach across Screens, so they are still done in order on this thread
+			for ( ScreenMap::iterator iter = mScreenMap.begin();
+					iter != mScreenMap.end(); iter++ ) {
+				Screen* screen = iter->second;
+				if ( screen->isAutoUpdating() && screen->_prepareUpdate() )
+					drawList.push_back( screen );
+			}
+		} catch ( ... ) {
+			texMgr._setUploadBuffer( 0 );
+			throw;
+		}
+
+		// each Screen draws only into its own command buffer, so they can all draw at once
+		try {
+			if ( mWorkerPool && drawList.size() > 1 ) {
+				// the shared class event tables must not be rebuilt while the workers read them
+				ClassEventList::_resolveAll();
+				std::vector<ScreenRecordJob> jobs;
+				jobs.reserve( drawList.size() );
+				WorkerPool::JobList jobList;
+				for ( ScreenList::iterator iter = drawList.begin(); iter != drawList.end(); iter++ ) {
+					jobs.push_back( ScreenRecordJob( *iter ) );
+					jobList.push_back( &jobs.back() );
+				}
+				mWorkerPool->run( jobList );
+			} else {
+				for ( ScreenList::iterator iter = drawList.begin(); iter != drawList.end(); iter++ )
+					( *iter )->_record();
+			}
+		} catch ( ... ) {
+			texMgr._setUploadBuffer( 0 );
+			for ( ScreenList::iterator iter = drawList.begin(); iter != drawList.end(); iter++ )
+				( *iter )->_getCommandBuffer().clear();
+			throw;
+		}
+		texMgr._setUploadBuffer( 0 );
+	}
+	//############################################################################
+	/*! Waits for any frame being submitted to finish, then clears and forgets the command
+	buffers of \c screen in the frames that have not been submitted yet. All of them are
+	discarded if \c screen is 0. The frames themselves stay queued, so recordScreens() and
+	submitScreens() remain in step. */
+	void ScreenManager::_discardFrames( Screen* screen ) {
+		MutexLock submitLock( mSubmitMutex );
+		MutexLock lock( mFrameMutex );
+		for ( FrameList::iterator frame = mFrames.begin(); frame != mFrames.end(); frame++ ) {
+			Frame::iterator iter = frame->begin();
+			while ( iter != frame->end() ) {
+				if ( !screen || *iter == &screen->mCommandBuffers[0] || *iter == &screen->mCommandBuffers[1] ) {
+					( *iter )->clear();
+					iter = frame->erase( iter );
+				} else
+					iter++;
+			}
+		}
+	}
+	//############################################################################
+	/*! \param threads The total number of threads that draw Screens, including the thread that
+	calls updateScreens(). 1, the default, draws every Screen on the calling thread.
+
+	Each Screen's draw commands are recorded on whichever thread is free, and then sent to the
+	Renderer in Screen name order from the thread that called updateScreens(). Input injection
+	and layout are always done on the calling thread. Any event handlers, Brush users, or custom
+	widgets that draw must therefore not touch anything outside of the Screen being drawn.
+
+	This requires OpenGUI to be built with \c OPENGUI_THREADED_UPDATE defined (see OpenGUI_CONFIG.h)
+	and a Renderer that returns \c true from Renderer::supportsThreadedTextures(). If either is
+	missing, a warning is logged and Screens continue to be drawn on the calling thread. */
+	void ScreenManager::setUpdateThreads( unsigned int threads ) {
+		if ( threads == getUpdateThreads() )
+			return;
+#ifndef OPENGUI_THREADED_UPDATE
+		if ( threads > 1 ) {
+			LogManager::SlogMsg( "ScreenManager", OGLL_WARN ) << "OpenGUI was built without OPENGUI_THREADED_UPDATE, "
+			<< "Screens will continue to be updated on a single thread" << Log::endlog;
+			threads = 1;
+		}
+#endif
+		if ( threads > 1 && !Renderer::getSingleton().supportsThreadedTextures() ) {
+			LogManager::SlogMsg( "ScreenManager", OGLL_WARN ) << "Renderer does not support threaded textures, "
+			<< "Screens will continue to be updated on a single thread" << Log::endlog;
+			threads = 1;
+		}
+		delete mWorkerPool;
+		mWorkerPool = 0;
+		if ( threads > 1 )
+			mWorkerPool = new WorkerPool( threads - 1 );
+	}
+	//############################################################################
+	unsigned int ScreenManager::getUpdateThreads() const {
+		return mWorkerPool ? mWorkerPool->getWorkerCount() + 1 : 1;
+	}
+	//############################################################################
 	void ScreenManager::updateTime() {
 		unsigned int timepassed = mTimer->getMilliseconds();
 		mTimer->reset();
@@ -106,8 +321,25 @@ namespace OpenGUI {
 
 	}
 	//############################################################################
+	/*! Hosts driving the GUI through System::update() can sleep for this many seconds,
+	or until they have input to inject, without the GUI falling behind. */
+	float ScreenManager::getNextWakeup() {
+		float soonest = -1.0f;
+		for ( ScreenMap::iterator iter = mScreenMap.begin();
+				iter != mScreenMap.end(); iter++ ) {
+			Screen* screen = iter->second;
+			if ( !screen->isAutoUpdating() )
+				continue;
+			float wakeup = screen->getNextWakeup();
+			if ( wakeup >= 0.0f && ( soonest < 0.0f || wakeup < soonest ) )
+				soonest = wakeup;
+		}
+		return soonest;
+	}
+	//############################################################################
 	void ScreenManager::destroyAllScreens() {
 		LogManager::SlogMsg( "ScreenManager", OGLL_INFO2 ) << "Destroy All Screens..." << Log::endlog;
+		_discardFrames( 0 );
 		for ( ScreenMap::iterator iter = mScreenMap.begin();
 				iter != mScreenMap.end(); iter++ ) {
 			Screen* tmp = iter->second;
@@ -14,6 +14,8 @@
 #include "OpenGUI_Iterators.h"
 #include "OpenGUI_Statistic.h"
 #include "OpenGUI_XML.h"
+#include "OpenGUI_Thread.h"
+#include "OpenGUI_RenderCommandBuffer.h"
 
 namespace OpenGUI {
 	class System;
@@ -48,9 +50,22 @@ namespace OpenGUI {
 		//! performs an update on all screens that are auto updating
 		void updateScreens();
 
+		//! Updates all auto updating screens like updateScreens(), but queues the Renderer calls for submitScreens()
+		void recordScreens();
+		//! Sends the oldest frame recorded by recordScreens() to the Renderer
+		bool submitScreens();
+
+		//! Sets the number of threads used by updateScreens() and recordScreens() to draw Screens
+		void setUpdateThreads( unsigned int threads );
+		//! Returns the number of threads used by updateScreens() and recordScreens() to draw Screens. \see setUpdateThreads()
+		unsigned int getUpdateThreads() const;
+
 		//! performs time injections on all screens that are auto timing using TimerManager as the time source
 		void updateTime();
 
+		//! Returns the soonest Screen::getNextWakeup() of all auto updating Screens, or -1.0f if none of them need to be updated
+		float getNextWakeup();
+
 		//! returns an iterator to walk the current list of screens
 		/*! The Key half of the iterator is the Screen name (String),
 		the %Value half is a pointer to the Screen (Screen *) */
@@ -80,6 +95,21 @@ namespace OpenGUI {
 
 		ScreenMap mScreenMap;
 		TimerPtr mTimer;
+		WorkerPool* mWorkerPool; // 0 when Screens are updated on a single thread
+
+		typedef std::vector<Screen*> ScreenList;
+		void _recordScreens( ScreenList& drawList, RenderCommandBuffer& uploads ); // prepares and records every auto updating Screen, listing those that drew
+
+		// frames queued by recordScreens() for submitScreens()
+		typedef std::vector<RenderCommandBuffer*> Frame;
+		typedef std::list<Frame> FrameList;
+		FrameList mFrames; // oldest first
+		RenderCommandBuffer mUploadBuffers[2]; // texture updates made while recording, sent ahead of the Screens of each frame
+		unsigned int mUploadBuffer; // the one recordScreens() records into, never part of a queued frame
+		Mutex mFrameMutex; // guards mFrames
+		Mutex mSubmitMutex; // held while a frame is submitted
+		Semaphore mFrameFree; // frames that may be recorded before one must be submitted
+		void _discardFrames( Screen* screen ); // removes the command buffers of screen from the queued frames, or all if 0
 
 		//Statistics
 		TimerPtr mFPSTimer;
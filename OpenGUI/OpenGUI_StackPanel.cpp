@@ -0,0 +1,166 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#include "OpenGUI_StackPanel.h"
+#include "OpenGUI_Macros.h"
+
+namespace OpenGUI {
+	//############################################################################
+
+	SimpleProperty_Bool( property_Vertical, "Vertical", StackPanel, getVertical, setVertical );
+	SimpleProperty_Bool( property_Wrap, "Wrap", StackPanel, getWrap, setWrap );
+	SimpleProperty_Float( property_StackSpacing, "Spacing", StackPanel, getSpacing, setSpacing );
+
+	//############################################################################
+	class StackPanel_ObjectAccessorList : public ObjectAccessorList {
+	public:
+		StackPanel_ObjectAccessorList() {
+			addAccessor( &property_Vertical );
+			addAccessor( &property_Wrap );
+			addAccessor( &property_StackSpacing );
+		}
+		~StackPanel_ObjectAccessorList() {}
+	}
+	gStackPanel_ObjectAccessorList;
+
+	//############################################################################
+	//############################################################################
+
+
+	//############################################################################
+	StackPanel::StackPanel() {
+		if ( gStackPanel_ObjectAccessorList.getParent() == 0 )
+			gStackPanel_ObjectAccessorList.setParent( ContainerControl::getAccessors() );
+
+		mVertical = true;
+		mWrap = false;
+		mSpacing = 0.0f;
+	}
+	//############################################################################
+	StackPanel::~StackPanel() {
+		/**/
+	}
+	//############################################################################
+	ObjectAccessorList* StackPanel::getAccessors() {
+		return &gStackPanel_ObjectAccessorList;
+	}
+	//############################################################################
+	unsigned int StackPanel::getObjectType() const {
+		return OT_STACKPANEL;
+	}
+	//############################################################################
+	void StackPanel::setVertical( bool vertical ) {
+		if ( mVertical == vertical ) return;
+		mVertical = vertical;
+		_invalidatedChildMeasure();
+	}
+	//############################################################################
+	bool StackPanel::getVertical() {
+		return mVertical;
+	}
+	//############################################################################
+	void StackPanel::setWrap( bool wrap ) {
+		if ( mWrap == wrap ) return;
+		mWrap = wrap;
+		_invalidatedChildMeasure();
+	}
+	//############################################################################
+	bool StackPanel::getWrap() {
+		return mWrap;
+	}
+	//############################################################################
+	/*! Negative values are clamped to 0.0f */
+	void StackPanel::setSpacing( float spacing ) {
+		if ( spacing < 0.0f ) spacing = 0.0f;
+		if ( mSpacing == spacing ) return;
+		mSpacing = spacing;
+		_invalidatedChildMeasure();
+	}
+	//############################################################################
+	float StackPanel::getSpacing() {
+		return mSpacing;
+	}
+	//############################################################################
+	void StackPanel::_invalidatedChildMeasure() {
+		invalidateMeasure();
+		invalidateLayout();
+	}
+	//############################################################################
+	void StackPanel::onResized( Object* sender, Resized_EventArgs& evtArgs ) {
+		if ( mWrap )
+			invalidateLayout();
+		ContainerControl::onResized( sender, evtArgs );
+	}
+	//############################################################################
+	/*! When wrapping, the panel fills whatever length it is given along the stacking
+	axis, so only the other axis is sized to the children. */
+	FVector2 StackPanel::_measure() {
+		FVector2 used = _stack( false );
+		float padding = getPadding();
+		FVector2 size( used.x + padding * 2.0f + m_ClientAreaOffset_UL.x - m_ClientAreaOffset_LR.x,
+					   used.y + padding * 2.0f + m_ClientAreaOffset_UL.y - m_ClientAreaOffset_LR.y );
+		if ( mWrap ) {
+			if ( mVertical )
+				size.y = getHeight();
+			else
+				size.x = getWidth();
+		}
+		return size;
+	}
+	//############################################################################
+	void StackPanel::_doUpdateLayout() {
+		_stack( true );
+	}
+	//############################################################################
+	/*! Walks the visible children in order, returning the area they use. Children
+	are only moved and sized when \c arrange is \c true, so the same walk serves
+	both measuring and arranging. */
+	FVector2 StackPanel::_stack( bool arrange ) {
+		FRect area = getClientArea();
+		float padding = getPadding();
+		FVector2 origin( area.min.x + padding, area.min.y + padding );
+		float limit = ( mVertical ? area.getHeight() : area.getWidth() ) - ( padding * 2.0f );
+
+		float lineStart = 0.0f; // position of the current row/column across the stacking axis
+		float lineDepth = 0.0f; // thickness of the current row/column
+		float lineEnd = 0.0f; // position along the stacking axis where the next child goes
+		bool lineEmpty = true;
+		float usedLength = 0.0f;
+
+		WidgetCollection::iterator iter, iterend = Children.end();
+		for ( iter = Children.begin(); iter != iterend; iter++ ) {
+			Control* ctrl = Control::_cast( iter.get() );
+			if ( !ctrl || !ctrl->getVisible() )
+				continue;
+			FVector2 size = ctrl->getDesiredSize();
+			float margin = ctrl->getMargin();
+			float length = ( mVertical ? size.y : size.x ) + margin * 2.0f;
+			float depth = ( mVertical ? size.x : size.y ) + margin * 2.0f;
+
+			float start = lineEmpty ? 0.0f : lineEnd + mSpacing;
+			if ( mWrap && !lineEmpty && start + length > limit ) {
+				lineStart += lineDepth + mSpacing;
+				lineDepth = 0.0f;
+				start = 0.0f;
+			}
+
+			if ( arrange ) {
+				FVector2 pos = mVertical ? FVector2( lineStart, start ) : FVector2( start, lineStart );
+				ctrl->setLeft( origin.x + pos.x + margin );
+				ctrl->setTop( origin.y + pos.y + margin );
+				ctrl->setWidth( size.x );
+				ctrl->setHeight( size.y );
+			}
+
+			lineEnd = start + length;
+			lineEmpty = false;
+			if ( lineEnd > usedLength ) usedLength = lineEnd;
+			if ( depth > lineDepth ) lineDepth = depth;
+		}
+
+		float usedDepth = lineStart + lineDepth;
+		return mVertical ? FVector2( usedDepth, usedLength ) : FVector2( usedLength, usedDepth );
+	}
+	//############################################################################
+} // namespace OpenGUI {
@@ -0,0 +1,79 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#ifndef CFA909E4_7446_434D_BC1F_B967108A487F
+#define CFA909E4_7446_434D_BC1F_B967108A487F
+
+#include "OpenGUI_PreRequisites.h"
+#include "OpenGUI_Exports.h"
+#include "OpenGUI_Types.h"
+#include "OpenGUI_ContainerControl.h"
+
+namespace OpenGUI {
+
+	//! ContainerControl that places its children one after another in a row or column
+	/*! Children are placed in collection order, each at its desired size (see
+	Control::getDesiredSize()) plus its margin, separated by the Spacing. With Wrap
+	enabled, a new row or column is started whenever the next child would pass the
+	end of the client area, producing a flow layout. Hidden children take no space.
+
+	The desired size of each child is cached, so a change to one child only costs a
+	re-measure of that child and a single queued layout pass of this container. The
+	desired size of a StackPanel is the area its children need, which allows them to
+	be nested within each other.
+
+	\par Properties
+	- Vertical: setVertical(), getVertical()
+	- Wrap: setWrap(), getWrap()
+	- Spacing: setSpacing(), getSpacing()
+	*/
+	class OPENGUI_API StackPanel : public ContainerControl {
+	public:
+		//! public constructor
+		StackPanel();
+		//! public destructor
+		virtual ~StackPanel();
+
+		//! Sets if children are stacked top to bottom (\c true, the default) or left to right (\c false)
+		void setVertical( bool vertical );
+		//! Returns \c true if children are stacked top to bottom
+		bool getVertical();
+
+		//! Sets if children wrap into additional rows or columns when they run out of room. Default is \c false
+		void setWrap( bool wrap );
+		//! Returns \c true if children wrap into additional rows or columns
+		bool getWrap();
+
+		//! Sets the space left between neighboring children, and between wrapped rows or columns
+		void setSpacing( float spacing );
+		//! Returns the space left between neighboring children
+		float getSpacing();
+
+		//Object Functions
+		virtual ObjectAccessorList* getAccessors();
+		virtual unsigned int getObjectType() const;
+
+		//! \internal re-measures this container and queues a layout update
+		virtual void _invalidatedChildMeasure();
+
+	protected:
+		//! re-flows wrapped children when the available space changes
+		virtual void onResized( Object* sender, Resized_EventArgs& evtArgs );
+
+		//! Returns the space needed to stack all visible children
+		virtual FVector2 _measure();
+		//! Positions the children
+		virtual void _doUpdateLayout();
+
+	private:
+		FVector2 _stack( bool arrange );
+
+		bool mVertical;
+		bool mWrap;
+		float mSpacing;
+	};
+
+} // namespace OpenGUI{
+
+#endif // CFA909E4_7446_434D_BC1F_B967108A487F
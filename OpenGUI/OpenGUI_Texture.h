@@ -27,7 +27,7 @@ namespace OpenGUI {
 		friend class TextureManager;
 	public:
 		//! Textures should only be created by Renderer implementations.
-		Texture() {}
+		Texture(): mByteSize( 0 ), mLRUPrev( 0 ), mLRUNext( 0 ), mEvicted( false ) {}
 		//! Textures should only be destroyed by Renderer implementations.
 		virtual ~Texture() {}
 
@@ -65,6 +65,12 @@ namespace OpenGUI {
 
 		//! returns \c true if this object is a RenderTexture, \c false otherwise
 		virtual bool isRenderTexture();
+
+		//! returns \c true if the contents of this texture are currently evicted by the TextureManager memory budget
+		/*! Evicted textures are reloaded automatically the next time they are drawn. \see TextureManager::setMemoryBudget() */
+		bool isEvicted() const {
+			return mEvicted;
+		}
 	protected:
 		//! It is required that this be set to the source filename by custom Renderers
 		/*! This sets what is mostly a symbolic name for a texture that is only used
@@ -97,6 +103,13 @@ namespace OpenGUI {
 		virtual void finalize(); //finalizer from RefObject
 		String mTextureName;
 		IVector2 mTextureSize;
+
+		// TextureManager residency tracking
+		String mSourceFile; // set for textures created from files, which makes them evictable
+		size_t mByteSize; // estimated memory footprint while resident
+		Texture* mLRUPrev; // TextureManager eviction order, only resident file based textures are linked
+		Texture* mLRUNext;
+		bool mEvicted; // contents currently released by the memory budget
 	};
 
 	//! A self deleting reference counted pointer for Texture objects
@@ -6,6 +6,11 @@
 #include "OpenGUI_Renderer.h"
 #include "OpenGUI_Exception.h"
 #include "OpenGUI_LogSystem.h"
+#include "OpenGUI_TextureData.h"
+#include "OpenGUI_RenderCommandBuffer.h"
+#include "OpenGUI_System.h"
+#include "OpenGUI_ResourceProvider.h"
+#include "OpenGUI_Resource.h"
 
 namespace OpenGUI {
 	//############################################################################
@@ -25,7 +30,22 @@ namespace OpenGUI {
 	TextureManager::TextureManager( Renderer* renderer ) {
 		LogManager::SlogMsg( "INIT", OGLL_INFO2 ) << "Creating TextureManager" << Log::endlog;
 		mRenderer = renderer;
+		mUploadBuffer = 0;
 		mRTTavail = mRenderer->supportsRenderToTexture();
+		mRepeatAvail = mRenderer->supportsTextureRepeat();
+		mEvictionAvail = mRenderer->supportsTextureEviction();
+		mMemoryBudget = 0;
+		mResidentBytes = 0;
+		mLRUFront = 0;
+		mLRUBack = 0;
+		mStatEvictions = 0;
+		mStatReloads = 0;
+		mStatDedupHits = 0;
+		mFileContentSharing = false;
+		mRTTPoolSize = 16 * 1024 * 1024;
+		mRTTPoolBytes = 0;
+		mStatRTTPoolHits = 0;
+		mStatRTTPoolMisses = 0;
 	}
 	//############################################################################
 	TextureManager::~TextureManager() {
@@ -34,24 +54,92 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	TexturePtr TextureManager::createTextureFromFile( const String& filename ) {
+		UpdateLock lock( mMutex );
 		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Create Texture from File: " << filename << Log::endlog;
+
+		// the same file is shared without being read again
+		FileTextureMap::iterator fileIter = mFileTextureMap.find( filename );
+		if ( fileIter != mFileTextureMap.end() ) {
+			Texture* shared = fileIter->second;
+			mSharedTextureMap[shared].shares++;
+			mStatDedupHits++;
+			LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Sharing Texture: " << shared->getName() << " for: " << filename << Log::endlog;
+			return TexturePtr( shared );
+		}
+
+		// when asked to, hash the file contents so we can share the texture if these contents are already loaded
+		ContentKey key;
+		std::vector<unsigned char> content;
+		bool hashed = false;
+		ResourceProvider* rp = mFileContentSharing ? System::getSingleton()._getResourceProvider() : 0;
+		if ( rp ) {
+			Resource res;
+			try {
+				rp->loadResource( filename, res );
+				if ( res.getData() ) {
+					key = _hashContent( res.getData(), res.getSize() );
+					content.assign( res.getData(), res.getData() + res.getSize() );
+					hashed = true;
+				}
+			} catch ( Exception& ) {
+				// leave it to the Renderer to find the file, or fail
+			}
+			rp->unloadResource( res );
+		}
+		const unsigned char* contentData = content.empty() ? 0 : &content[0];
+		if ( hashed ) {
+			Texture* shared = _findShared( key, contentData );
+			if ( shared ) {
+				LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Sharing Texture: " << shared->getName() << " for: " << filename << Log::endlog;
+				return TexturePtr( shared );
+			}
+		}
+
 		Texture* tex = mRenderer->createTextureFromFile( filename );
+		if ( !tex ) return TexturePtr( 0 );
 		mTextureCPtrList.push_front( tex );
+		tex->mSourceFile = filename;
+		const IVector2& size = tex->getSize();
+		_addResident( tex, size.x * size.y * 4 );
+		_addShared( tex, hashed ? &key : 0, contentData );
+		mFileTextureMap[filename] = tex;
+		_enforceMemoryBudget( tex );
 		return TexturePtr( tex );
 	}
 	//############################################################################
-	TexturePtr TextureManager::createTextureFromTextureData( const String& name, TextureData* textureData ) {
+	TexturePtr TextureManager::createTextureFromTextureData( const String& name, TextureData* textureData, bool shareable ) {
+		UpdateLock lock( mMutex );
 		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Create Texture from TextureData: "
 		<< name
 		<< " (" << ( size_t ) textureData << ")"
 		<< Log::endlog;
+
+		const size_t byteSize = textureData->getWidth() * textureData->getHeight() * textureData->getBPP();
+		ContentKey key;
+		if ( shareable ) {
+			key = _hashContent( textureData->getPixelData(), byteSize );
+			key.width = textureData->getWidth();
+			key.height = textureData->getHeight();
+			key.bpp = textureData->getBPP();
+			Texture* shared = _findShared( key, textureData->getPixelData() );
+			if ( shared ) {
+				LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Sharing Texture: " << shared->getName() << " for: " << name << Log::endlog;
+				return TexturePtr( shared );
+			}
+		}
+
 		Texture* tex = mRenderer->createTextureFromTextureData( textureData );
 		tex->_setName( name );
 		mTextureCPtrList.push_front( tex );
+		_addResident( tex, byteSize );
+		if ( shareable )
+			_addShared( tex, &key, textureData->getPixelData() );
+		_enforceMemoryBudget( tex );
 		return TexturePtr( tex );
 	}
 	//############################################################################
 	void TextureManager::updateTextureFromTextureData( TexturePtr texturePtr, TextureData* textureData ) {
+		UpdateLock lock( mMutex );
 		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Update Texture from TextureData: "
 		<< texturePtr->getName()
 		<< " (" << ( size_t ) textureData << ")"
@@ -59,36 +147,265 @@ namespace OpenGUI {
 
 		Texture* tex;
 		tex = texturePtr.get();
-		mRenderer->updateTextureFromTextureData( tex, textureData );
+		if ( tex->mEvicted )
+			_reloadTexture( tex ); // restore first, so the renderer is working with a live texture
+		if ( mUploadBuffer )
+			mUploadBuffer->updateTexture( tex, textureData ); // sent with the frame being recorded
+		else
+			mRenderer->updateTextureFromTextureData( tex, textureData );
+
+		// the contents no longer match the source file or the hashed contents, so stop handing this texture out to new requests
+		SharedTextureMap::iterator iter = mSharedTextureMap.find( tex );
+		if ( iter != mSharedTextureMap.end() && iter->second.shares > 1 )
+			LogManager::SlogMsg( "TextureManager", OGLL_WARN ) << "Updating shared Texture: " << tex->getName()
+			<< " (" << iter->second.shares << " requests share this texture)" << Log::endlog;
+		_unindexShared( tex );
+		// nor can it be reloaded from the source file, so this is no longer evictable
+		_lruRemove( tex );
+		tex->mSourceFile = "";
+		mResidentBytes -= tex->mByteSize;
+		_addResident( tex, textureData->getWidth() * textureData->getHeight() * textureData->getBPP() );
+		_enforceMemoryBudget( tex );
 	}
 	//############################################################################
 	void TextureManager::destroyTexture( Texture* texturePtr ) {
+		UpdateLock lock( mMutex );
 		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "DestroyTexture: " << texturePtr->getName() << " " << texturePtr << Log::endlog;
 		mTextureCPtrList.remove( texturePtr );
+		_removeShared( texturePtr );
+		_lruRemove( texturePtr );
+		if ( !texturePtr->mEvicted )
+			mResidentBytes -= texturePtr->mByteSize;
 		mRenderer->destroyTexture( texturePtr );
 	}
 	//############################################################################
 	void TextureManager::destroyAllTextures() {
+		UpdateLock lock( mMutex );
 		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "DestroyAllTextures..." << Log::endlog;
 		Texture* tex;
 		while ( mTextureCPtrList.size() > 0 ) {
 			tex = mTextureCPtrList.front();
 			mTextureCPtrList.pop_front();
+			_removeShared( tex );
+			_lruRemove( tex );
+			if ( !tex->mEvicted )
+				mResidentBytes -= tex->mByteSize;
 			mRenderer->destroyTexture( tex );
 		}
+		_trimRTTPool( 0 );
 	}
 	//############################################################################
 	RenderTexturePtr TextureManager::createRenderTexture( const IVector2& size ) {
+		UpdateLock lock( mMutex );
 		if ( !mRTTavail )
 			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Cannot create RenderTexture when Renderer does not support this feature", __FUNCTION__ );
-		RenderTexture* tex = mRenderer->createRenderTexture( size );
+		// round up to the pool bucket, so nearby sizes can share render textures
+		IVector2 bucket( 1, 1 );
+		while ( bucket.x < size.x ) bucket.x <<= 1;
+		while ( bucket.y < size.y ) bucket.y <<= 1;
+
+		for ( RenderTextureCPtrList::iterator iter = mRTTPool.begin(); iter != mRTTPool.end(); iter++ ) {
+			RenderTexture* tex = ( *iter );
+			if ( tex->getSize() == bucket ) {
+				mRTTPool.erase( iter );
+				mRTTPoolBytes -= tex->mByteSize;
+				mStatRTTPoolHits++;
+				return RenderTexturePtr( tex );
+			}
+		}
+
+		RenderTexture* tex = mRenderer->createRenderTexture( bucket );
+		if ( tex ) {
+			_addResident( tex, tex->getSize().x * tex->getSize().y * 4 );
+			mStatRTTPoolMisses++;
+		}
 		return RenderTexturePtr( tex );
 	}
 	//############################################################################
 	void TextureManager::destroyRenderTexture( RenderTexture* texturePtr ) {
+		UpdateLock lock( mMutex );
 		if ( !mRTTavail )
 			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Cannot destroy RenderTexture when Renderer does not support this feature", __FUNCTION__ );
-		mRenderer->destroyRenderTexture( texturePtr );
+		mRTTPool.push_front( texturePtr );
+		mRTTPoolBytes += texturePtr->mByteSize;
+		_trimRTTPool( mRTTPoolSize );
+	}
+	//############################################################################
+	void TextureManager::setRenderTexturePoolSize( size_t bytes ) {
+		UpdateLock lock( mMutex );
+		mRTTPoolSize = bytes;
+		_trimRTTPool( mRTTPoolSize );
+	}
+	//############################################################################
+	void TextureManager::_trimRTTPool( size_t bytes ) {
+		while ( mRTTPoolBytes > bytes ) {
+			RenderTexture* tex = mRTTPool.back();
+			mRTTPool.pop_back();
+			mRTTPoolBytes -= tex->mByteSize;
+			mResidentBytes -= tex->mByteSize;
+			mRenderer->destroyRenderTexture( tex );
+		}
+	}
+	//############################################################################
+	void TextureManager::setMemoryBudget( size_t bytes ) {
+		UpdateLock lock( mMutex );
+		LogManager::SlogMsg( "TextureManager", OGLL_INFO ) << "Memory budget set to: " << bytes << " bytes" << Log::endlog;
+		if ( bytes && !mEvictionAvail )
+			LogManager::SlogMsg( "TextureManager", OGLL_WARN ) << "Renderer does not support texture eviction, memory budget will not be enforced" << Log::endlog;
+		mMemoryBudget = bytes;
+		_enforceMemoryBudget();
+	}
+	//############################################################################
+	void TextureManager::statsResetCounters() {
+		UpdateLock lock( mMutex );
+		mStatEvictions = 0;
+		mStatReloads = 0;
+		mStatDedupHits = 0;
+		mStatRTTPoolHits = 0;
+		mStatRTTPoolMisses = 0;
+	}
+	//############################################################################
+	size_t TextureManager::statGetDedupBytes() const {
+		size_t total = 0;
+		for ( SharedTextureMap::const_iterator iter = mSharedTextureMap.begin(); iter != mSharedTextureMap.end(); iter++ ) {
+			const unsigned int handles = iter->first->getHandleCount();
+			const unsigned int shares = iter->second.shares < handles ? iter->second.shares : handles;
+			if ( shares > 1 )
+				total += ( shares - 1 ) * iter->first->mByteSize;
+		}
+		return total;
+	}
+	//############################################################################
+	TextureManager::ContentKey TextureManager::_hashContent( const unsigned char* data, size_t length ) {
+		ContentKey key;
+		key.hashA = 2166136261U;
+		key.hashB = 0;
+		for ( size_t i = 0; i < length; i++ ) {
+			key.hashA = ( key.hashA ^ data[i] ) * 16777619U;
+			key.hashB = data[i] + ( key.hashB << 6 ) + ( key.hashB << 16 ) - key.hashB;
+		}
+		key.length = length;
+		key.width = key.height = key.bpp = 0;
+		return key;
+	}
+	//############################################################################
+	Texture* TextureManager::_findShared( const ContentKey& key, const unsigned char* data ) {
+		ContentTextureMap::iterator iter = mContentTextureMap.find( key );
+		if ( iter == mContentTextureMap.end() )
+			return 0;
+		Texture* tex = iter->second;
+		SharedTexture& entry = mSharedTextureMap[tex];
+		if ( !std::equal( entry.content.begin(), entry.content.end(), data ) )
+			return 0; // the hashes collided
+		entry.shares++;
+		mStatDedupHits++;
+		return tex;
+	}
+	//############################################################################
+	void TextureManager::_addShared( Texture* texture, const ContentKey* key, const unsigned char* data ) {
+		SharedTexture& entry = mSharedTextureMap[texture];
+		entry.shares = 1;
+		// if these contents collided with a texture that is already indexed, that one stays indexed
+		if ( key && mContentTextureMap.find( *key ) == mContentTextureMap.end() ) {
+			entry.key = *key;
+			entry.content.assign( data, data + key->length );
+			entry.indexed = true;
+			mContentTextureMap[*key] = texture;
+		}
+	}
+	//############################################################################
+	void TextureManager::_unindexShared( Texture* texture ) {
+		if ( !texture->mSourceFile.empty() ) {
+			FileTextureMap::iterator fileIter = mFileTextureMap.find( texture->mSourceFile );
+			if ( fileIter != mFileTextureMap.end() && fileIter->second == texture )
+				mFileTextureMap.erase( fileIter );
+		}
+		SharedTextureMap::iterator iter = mSharedTextureMap.find( texture );
+		if ( iter != mSharedTextureMap.end() && iter->second.indexed ) {
+			mContentTextureMap.erase( iter->second.key );
+			iter->second.indexed = false;
+			std::vector<unsigned char>().swap( iter->second.content );
+		}
+	}
+	//############################################################################
+	void TextureManager::_removeShared( Texture* texture ) {
+		_unindexShared( texture );
+		mSharedTextureMap.erase( texture );
+	}
+	//############################################################################
+	void TextureManager::_addResident( Texture* texture, size_t byteSize ) {
+		texture->mByteSize = byteSize;
+		mResidentBytes += byteSize;
+		if ( !texture->mSourceFile.empty() )
+			_lruPushBack( texture ); // new textures start as the most recently used
+	}
+	//############################################################################
+	void TextureManager::_reloadTexture( Texture* texture ) {
+		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Reload evicted Texture: " << texture->mSourceFile << Log::endlog;
+		mRenderer->reloadTexture( texture, texture->mSourceFile );
+		texture->mEvicted = false;
+		mResidentBytes += texture->mByteSize;
+		_lruPushBack( texture );
+		mStatReloads++;
+		_enforceMemoryBudget( texture );
+	}
+	//############################################################################
+	void TextureManager::_evictTexture( Texture* texture ) {
+		LogManager::SlogMsg( "TextureManager", OGLL_INFO2 ) << "Evict Texture: " << texture->mSourceFile << Log::endlog;
+		mRenderer->evictTexture( texture );
+		texture->mEvicted = true;
+		_lruRemove( texture );
+		mResidentBytes -= texture->mByteSize;
+		mStatEvictions++;
+	}
+	//############################################################################
+	/*! Pooled render textures are idle, so they are destroyed first. After that, the least
+	recently drawn file based textures are evicted until the resident total fits within the
+	memory budget, or until nothing else can be evicted. The \c keepTexture is never evicted,
+	as it is the texture that is currently being created or drawn. */
+	void TextureManager::_enforceMemoryBudget( Texture* keepTexture ) {
+		if ( mMemoryBudget == 0 || mResidentBytes <= mMemoryBudget )
+			return;
+		const size_t excess = mResidentBytes - mMemoryBudget;
+		_trimRTTPool( excess < mRTTPoolBytes ? mRTTPoolBytes - excess : 0 );
+		if ( !mEvictionAvail )
+			return;
+		Texture* tex = mLRUFront;
+		while ( tex && mResidentBytes > mMemoryBudget ) {
+			Texture* next = tex->mLRUNext;
+			if ( tex != keepTexture )
+				_evictTexture( tex );
+			tex = next;
+		}
+	}
+	//############################################################################
+	void TextureManager::_lruPushBack( Texture* texture ) {
+		texture->mLRUPrev = mLRUBack;
+		texture->mLRUNext = 0;
+		if ( mLRUBack )
+			mLRUBack->mLRUNext = texture;
+		else
+			mLRUFront = texture;
+		mLRUBack = texture;
+	}
+	//############################################################################
+	void TextureManager::_lruRemove( Texture* texture ) {
+		if ( !texture->mLRUPrev && mLRUFront != texture )
+			return; // not linked
+		if ( texture->mLRUPrev )
+			texture->mLRUPrev->mLRUNext = texture->mLRUNext;
+		else
+			mLRUFront = texture->mLRUNext;
+		if ( texture->mLRUNext )
+			texture->mLRUNext->mLRUPrev = texture->mLRUPrev;
+		else
+			mLRUBack = texture->mLRUPrev;
+		texture->mLRUPrev = texture->mLRUNext = 0;
+	}
+	//############################################################################
+	void TextureManager::_lruMoveToBack( Texture* texture ) {
+		_lruRemove( texture );
+		_lruPushBack( texture );
 	}
 	//############################################################################
 }//namespace OpenGUI{
\ No newline at end of file
@@ -14,11 +14,14 @@
 #include "OpenGUI_RenderTexture.h"
 
 #include "OpenGUI_Iterators.h"
+#include "OpenGUI_Thread.h"
+#include "OpenGUI_HashMap.h"
 
 namespace OpenGUI {
 	class Renderer; //forward declaration
 	class System; //forward declaration
 	class TextureData; //forward declaration
+	class RenderCommandBuffer; //forward declaration
 
 	/*! \brief
 	Provides a common interface for creating textures from various sources.
@@ -42,10 +45,24 @@ namespace OpenGUI {
 		static TextureManager* getSingletonPtr( void );
 
 		//! create a new texture. \c filename will be used at the texture name
+		/*! If a texture created from the same \c filename is still alive, a handle to it is returned
+		instead of loading the file again. When file content sharing is enabled, the same image
+		referenced under different paths is shared as well. \see setFileContentSharing() */
 		TexturePtr createTextureFromFile( const String& filename );
 		//! create a new texture from memory
-		TexturePtr createTextureFromTextureData( const String& name, TextureData* textureData );
+		/*! If \c shareable is \c true, the pixel data is hashed and compared, and an existing shareable
+		texture with identical contents (and dimensions) is returned if one exists. Only pass \c true
+		for textures that will never be given to updateTextureFromTextureData(), since updating a shared
+		texture changes it for every holder of a handle to it. Shareable textures keep a copy of their
+		pixel data for the comparison. */
+		TexturePtr createTextureFromTextureData( const String& name, TextureData* textureData, bool shareable = false );
 		//! Replace the given texture's contents with the contents of the given TextureData
+		/*! \note The texture is no longer considered for sharing after being updated. If the texture
+		was already being shared, the update is seen by all holders of it.
+
+		While ScreenManager is recording Screens on other threads or for submitScreens(), the
+		contents are copied into the recorded frame, and only reach the Renderer when that frame is
+		submitted. */
 		void updateTextureFromTextureData( TexturePtr texturePtr, TextureData* textureData );
 
 		//! Creates a new render texture of the requested \c size.
@@ -54,9 +71,25 @@ namespace OpenGUI {
 		it is up to the Renderer implementation to generate a texture large enough to contain the requested size,
 		and perform the necessary windowing to only allow drawing to occur within the requested area, as well as
 		remapping UVs so that 1.0x1.0 properly references the extents of the requested size, rather than the
-		full size of the texture. */
+		full size of the texture.
+
+		Render textures are pooled. The requested size is rounded up to the next power of 2 on each axis,
+		and a render texture of that size that was released earlier is handed out again instead of
+		creating a new one, so callers must use RenderTexture::getSize() rather than assume they received
+		the size they asked for. The contents of a reused render texture are undefined until cleared. */
 		RenderTexturePtr createRenderTexture( const IVector2& size );
 
+		//! Sets the number of bytes that released render textures may hold while waiting to be reused. Default is 16MB.
+		/*! Released render textures are destroyed, oldest first, once the pool grows beyond this size.
+		A size of 0 disables pooling, and destroys all pooled render textures immediately.
+		Pooled render textures are also destroyed before any texture is evicted to meet the memory
+		budget. \see setMemoryBudget() */
+		void setRenderTexturePoolSize( size_t bytes );
+		//! Returns the maximum number of bytes held by pooled render textures. \see setRenderTexturePoolSize()
+		size_t getRenderTexturePoolSize() const {
+			return mRTTPoolSize;
+		}
+
 		//! returns an iterator to walk the current list of Textures
 		iterator getIterator() {
 			return iterator( mTextureCPtrList.begin(), mTextureCPtrList.end() );
@@ -66,6 +99,100 @@ namespace OpenGUI {
 		bool supportsRenderToTexture() {
 			return mRTTavail;
 		}
+
+		//! returns true if the underlying Renderer repeats textures for UVs outside of the 0.0 - 1.0 range
+		bool supportsTextureRepeat() {
+			return mRepeatAvail;
+		}
+
+		//! Sets the memory budget, in bytes, for resident textures. A budget of 0 (the default) is unlimited.
+		/*! When the estimated size of all resident textures exceeds the budget, textures that were
+		created from files are evicted in least recently drawn order until the total fits within
+		the budget again. Evicted textures keep their Texture objects (so all existing handles
+		remain valid), and are transparently reloaded from their source file the next time they
+		are drawn. Textures created from TextureData and render textures are never evicted, but
+		do count toward the resident total. Render textures waiting in the pool for reuse are
+		destroyed first, before anything in use is evicted.
+
+		The budget is a soft limit. It is only enforced when the Renderer reports support via
+		Renderer::supportsTextureEviction(), and a budget smaller than the textures drawn in a single
+		frame will cause those textures to be evicted and reloaded every frame. */
+		void setMemoryBudget( size_t bytes );
+		//! Returns the current memory budget in bytes, 0 means unlimited. \see setMemoryBudget()
+		size_t getMemoryBudget() const {
+			return mMemoryBudget;
+		}
+
+		//! Returns the estimated number of bytes held by resident (not evicted) textures
+		/*! Sizes are estimated from the texture dimensions. TextureData based textures use their
+		actual bytes per pixel, while file based textures are assumed to be 4 bytes per pixel. */
+		size_t statGetResidentBytes() const {
+			return mResidentBytes;
+		}
+		//! Returns the number of textures evicted due to the memory budget since the last statsResetCounters()
+		unsigned int statGetEvictions() const {
+			return mStatEvictions;
+		}
+		//! Returns the number of evicted textures that were reloaded since the last statsResetCounters()
+		unsigned int statGetReloads() const {
+			return mStatReloads;
+		}
+		//! Enables sharing of file based textures whose files have identical contents. Default is \c false.
+		/*! This catches the same image being referenced under different paths, but every new file
+		is then read through the ResourceProvider to be hashed before the Renderer loads it, and a
+		copy of its contents is kept for comparison. Files that cannot be read through the
+		ResourceProvider are simply passed to the Renderer without sharing. */
+		void setFileContentSharing( bool enable ) {
+			mFileContentSharing = enable;
+		}
+		//! Returns \c true if file based textures are shared by contents. \see setFileContentSharing()
+		bool getFileContentSharing() const {
+			return mFileContentSharing;
+		}
+		//! Returns the estimated number of bytes saved by sharing textures with identical contents
+		/*! This is the size of every texture multiplied by the number of additional create requests
+		that it satisfied, for all textures that are currently alive. As handles are not tied to
+		requests, the count for each texture is limited to the handles still held to it, so the
+		value falls as holders of a shared texture release it. */
+		size_t statGetDedupBytes() const;
+		//! Returns the number of texture create requests that were satisfied by an existing texture since the last statsResetCounters()
+		unsigned int statGetDedupHits() const {
+			return mStatDedupHits;
+		}
+		//! Returns the estimated number of bytes held by released render textures waiting in the pool
+		/*! These bytes are also included in statGetResidentBytes() */
+		size_t statGetRTTPoolBytes() const {
+			return mRTTPoolBytes;
+		}
+		//! Returns the number of render texture requests satisfied from the pool since the last statsResetCounters()
+		unsigned int statGetRTTPoolHits() const {
+			return mStatRTTPoolHits;
+		}
+		//! Returns the number of render texture requests that created a new render texture since the last statsResetCounters()
+		unsigned int statGetRTTPoolMisses() const {
+			return mStatRTTPoolMisses;
+		}
+		//! Resets the eviction, reload, dedup hit, and render texture pool counters
+		void statsResetCounters();
+
+		//! \internal Returns the lock held while the TextureManager, and the Renderer through it, is in use
+		Mutex& _getMutex() {
+			return mMutex;
+		}
+		//! \internal Records texture updates into \c buffer instead of sending them to the Renderer, until called again with 0
+		void _setUploadBuffer( RenderCommandBuffer* buffer ) {
+			UpdateLock lock( mMutex );
+			mUploadBuffer = buffer;
+		}
+		//! \internal Marks the given texture as drawn, reloading it first if it is currently evicted
+		/*! This is called for every texture a Screen submits to the Renderer, so it needs to stay fast. */
+		void _touchTexture( Texture* texture ) {
+			UpdateLock lock( mMutex );
+			if ( texture->mEvicted )
+				_reloadTexture( texture );
+			else if ( texture->mLRUNext )
+				_lruMoveToBack( texture ); // linked, but not already the most recently used
+		}
 	protected:
 		//only allow creation and destruction by System
 		TextureManager( Renderer* renderer );
@@ -75,16 +202,81 @@ namespace OpenGUI {
 		/*! Called automatically by Texture objects when they have no further handles pointing to them */
 		void destroyTexture( Texture* texturePtr );
 
-		//! Destroys the given RenderTexture through Renderer->destroyRenderTexture
+		//! Returns the given RenderTexture to the pool, destroying it through Renderer->destroyRenderTexture if the pool is full
 		/*! Called automatically by RenderTexture objects when they have no further handles pointing to them */
 		void destroyRenderTexture( RenderTexture* texturePtr );
 	private:
 		// destroys all textures
 		void destroyAllTextures();
 		Renderer* mRenderer;
+		Mutex mMutex; // held by every method that changes the texture lists when OPENGUI_THREADED_UPDATE is defined
+		RenderCommandBuffer* mUploadBuffer; // receives texture updates instead of the Renderer when set
 		bool mRTTavail;
+		bool mRepeatAvail;
 
 		TextureCPtrList mTextureCPtrList;
+
+		// memory budget
+		void _addResident( Texture* texture, size_t byteSize ); // begins tracking bytes for the given texture
+		void _reloadTexture( Texture* texture ); // restores an evicted texture
+		void _evictTexture( Texture* texture ); // evicts the given texture
+		void _enforceMemoryBudget( Texture* keepTexture = 0 ); // trims the RTT pool, then evicts LRU textures until within budget
+		void _lruPushBack( Texture* texture ); // links the texture as the most recently used
+		void _lruRemove( Texture* texture ); // unlinks the texture, if it is linked
+		void _lruMoveToBack( Texture* texture );
+		Texture* mLRUFront; // least recently used evictable texture
+		Texture* mLRUBack; // most recently used evictable texture
+		bool mEvictionAvail;
+		size_t mMemoryBudget;
+		size_t mResidentBytes;
+		unsigned int mStatEvictions;
+		unsigned int mStatReloads;
+
+		// content sharing
+		struct ContentKey {
+			unsigned int hashA; // FNV-1a
+			unsigned int hashB; // sdbm, so fewer colliding keys reach the byte comparison
+			size_t length;
+			int width, height, bpp; // 0 for file based textures, whose dimensions are unknown until loaded
+			bool operator==( const ContentKey& right ) const {
+				return hashA == right.hashA && hashB == right.hashB && length == right.length
+					   && width == right.width && height == right.height && bpp == right.bpp;
+			}
+		};
+		struct ContentKeyHash {
+			size_t operator()( const ContentKey& key ) const {
+				return key.hashA;
+			}
+		};
+		static ContentKey _hashContent( const unsigned char* data, size_t length );
+		Texture* _findShared( const ContentKey& key, const unsigned char* data ); // returns an existing texture with the given contents, or 0
+		void _addShared( Texture* texture, const ContentKey* key, const unsigned char* data ); // key may be 0 to only count shares
+		void _unindexShared( Texture* texture ); // stops handing the texture out to new requests, called on update
+		void _removeShared( Texture* texture ); // forgets the texture entirely, called on destruction
+		typedef HashMap<ContentKey, Texture*, ContentKeyHash> ContentTextureMap;
+		ContentTextureMap mContentTextureMap;
+		typedef std::map<String, Texture*> FileTextureMap;
+		FileTextureMap mFileTextureMap; // file based textures by filename
+		bool mFileContentSharing;
+		struct SharedTexture {
+			SharedTexture(): shares( 0 ), indexed( false ) {}
+			ContentKey key;
+			std::vector<unsigned char> content; // the hashed bytes, compared before sharing so a hash collision cannot share the wrong texture
+			unsigned int shares; // number of create requests that resolved to this texture
+			bool indexed; // true while the key is present in mContentTextureMap
+		};
+		typedef HashMap<Texture*, SharedTexture> SharedTextureMap;
+		SharedTextureMap mSharedTextureMap;
+		unsigned int mStatDedupHits;
+
+		// render texture pool
+		typedef std::list<RenderTexture*> RenderTextureCPtrList;
+		RenderTextureCPtrList mRTTPool; // released render textures, most recently released first
+		void _trimRTTPool( size_t bytes ); // destroys the oldest pooled render textures until the pool fits in bytes
+		size_t mRTTPoolSize;
+		size_t mRTTPoolBytes;
+		unsigned int mStatRTTPoolHits;
+		unsigned int mStatRTTPoolMisses;
 	};
 
 } //namespace OpenGUI {
@@ -0,0 +1,191 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#include "OpenGUI_Thread.h"
+#include "OpenGUI_Exception.h"
+
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+#include <process.h>
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+#include <errno.h>
+#endif
+
+namespace OpenGUI {
+	//############################################################################
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+	Mutex::Mutex() {
+		InitializeCriticalSection( &mHandle ); // critical sections are always recursive
+	}
+	//############################################################################
+	Mutex::~Mutex() {
+		DeleteCriticalSection( &mHandle );
+	}
+	//############################################################################
+	void Mutex::lock() {
+		EnterCriticalSection( &mHandle );
+	}
+	//############################################################################
+	void Mutex::unlock() {
+		LeaveCriticalSection( &mHandle );
+	}
+	//############################################################################
+	Semaphore::Semaphore() {
+		mHandle = CreateSemaphore( NULL, 0, LONG_MAX, NULL );
+		if ( !mHandle )
+			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Failed to create semaphore", __FUNCTION__ );
+	}
+	//############################################################################
+	Semaphore::~Semaphore() {
+		CloseHandle( mHandle );
+	}
+	//############################################################################
+	void Semaphore::post( unsigned int count ) {
+		if ( count > 0 )
+			ReleaseSemaphore( mHandle, ( LONG ) count, NULL );
+	}
+	//############################################################################
+	void Semaphore::wait() {
+		WaitForSingleObject( mHandle, INFINITE );
+	}
+	//############################################################################
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+	Mutex::Mutex() {
+		pthread_mutexattr_t attr;
+		pthread_mutexattr_init( &attr );
+		pthread_mutexattr_settype( &attr, PTHREAD_MUTEX_RECURSIVE );
+		pthread_mutex_init( &mHandle, &attr );
+		pthread_mutexattr_destroy( &attr );
+	}
+	//############################################################################
+	Mutex::~Mutex() {
+		pthread_mutex_destroy( &mHandle );
+	}
+	//############################################################################
+	void Mutex::lock() {
+		pthread_mutex_lock( &mHandle );
+	}
+	//############################################################################
+	void Mutex::unlock() {
+		pthread_mutex_unlock( &mHandle );
+	}
+	//############################################################################
+	Semaphore::Semaphore() {
+		if ( sem_init( &mHandle, 0, 0 ) != 0 )
+			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Failed to create semaphore", __FUNCTION__ );
+	}
+	//############################################################################
+	Semaphore::~Semaphore() {
+		sem_destroy( &mHandle );
+	}
+	//############################################################################
+	void Semaphore::post( unsigned int count ) {
+		for ( unsigned int i = 0; i < count; i++ )
+			sem_post( &mHandle );
+	}
+	//############################################################################
+	void Semaphore::wait() {
+		while ( sem_wait( &mHandle ) != 0 && errno == EINTR )
+			; // interrupted by a signal, so keep waiting
+	}
+	//############################################################################
+#endif
+	//############################################################################
+	//############################################################################
+	WorkerPool::WorkerPool( unsigned int workerCount ) {
+		mJobs = 0;
+		mNextJob = 0;
+		mError = 0;
+		mStop = false;
+		for ( unsigned int i = 0; i < workerCount; i++ ) {
+			OPENGUI_THREAD_HANDLE thread;
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+			thread = ( HANDLE ) _beginthreadex( NULL, 0, &WorkerPool::_threadMain, this, 0, NULL );
+			const bool started = thread != 0;
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+			const bool started = pthread_create( &thread, NULL, &WorkerPool::_threadMain, this ) == 0;
+#endif
+			if ( !started )
+				break; // run with the threads we were able to get
+			mThreads.push_back( thread );
+		}
+	}
+	//############################################################################
+	WorkerPool::~WorkerPool() {
+		mStop = true;
+		mStart.post( getWorkerCount() );
+		for ( ThreadList::iterator iter = mThreads.begin(); iter != mThreads.end(); iter++ ) {
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+			WaitForSingleObject( *iter, INFINITE );
+			CloseHandle( *iter );
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+			pthread_join( *iter, NULL );
+#endif
+		}
+	}
+	//############################################################################
+	void WorkerPool::run( const JobList& jobs ) {
+		mJobs = &jobs;
+		mNextJob = 0;
+		mError = 0;
+		// there is no point in waking more workers than there are jobs for the others
+		unsigned int workers = getWorkerCount();
+		if ( jobs.size() <= workers )
+			workers = jobs.size() > 0 ? ( unsigned int ) jobs.size() - 1 : 0;
+		mStart.post( workers );
+		_work();
+		for ( unsigned int i = 0; i < workers; i++ )
+			mDone.wait();
+		mJobs = 0;
+
+		if ( mError ) {
+			Exception error( *mError );
+			delete mError;
+			mError = 0;
+			throw error;
+		}
+	}
+	//############################################################################
+	void WorkerPool::_work() {
+		for ( ;; ) {
+			mMutex.lock();
+			const size_t index = mNextJob++;
+			mMutex.unlock();
+			if ( index >= mJobs->size() )
+				return;
+
+			Exception* error = 0;
+			try {
+				( *mJobs )[index]->run();
+			} catch ( Exception& e ) {
+				error = new Exception( e );
+			} catch ( ... ) {
+				error = new Exception( Exception::ERR_INTERNAL_ERROR, "Unknown exception thrown by a worker thread", __FUNCTION__ );
+			}
+			if ( error ) {
+				MutexLock lock( mMutex );
+				if ( mError )
+					delete error; // only the first is reported
+				else
+					mError = error;
+			}
+		}
+	}
+	//############################################################################
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+	unsigned int __stdcall WorkerPool::_threadMain( void* pool ) {
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+	void* WorkerPool::_threadMain( void* pool ) {
+#endif
+		WorkerPool* self = static_cast<WorkerPool*>( pool );
+		for ( ;; ) {
+			self->mStart.wait();
+			if ( self->mStop )
+				break;
+			self->_work();
+			self->mDone.post();
+		}
+		return 0;
+	}
+	//############################################################################
+} // namespace OpenGUI{
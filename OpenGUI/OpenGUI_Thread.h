@@ -0,0 +1,139 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#ifndef E089FF81_7045_4788_A19F_FBC97CC78368
+#define E089FF81_7045_4788_A19F_FBC97CC78368
+
+#include "OpenGUI_PreRequisites.h"
+#include "OpenGUI_Exports.h"
+
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+#define OPENGUI_MUTEX_HANDLE CRITICAL_SECTION
+#define OPENGUI_SEMAPHORE_HANDLE HANDLE
+#define OPENGUI_THREAD_HANDLE HANDLE
+
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+#include <pthread.h>
+#include <semaphore.h>
+#define OPENGUI_MUTEX_HANDLE pthread_mutex_t
+#define OPENGUI_SEMAPHORE_HANDLE sem_t
+#define OPENGUI_THREAD_HANDLE pthread_t
+
+#endif
+
+namespace OpenGUI {
+	class Exception; //forward declaration
+
+	//! \internal A recursive mutual exclusion lock
+	/*! The thread holding the lock may lock it again, and must unlock it as many times. */
+	class OPENGUI_API Mutex {
+	public:
+		Mutex();
+		~Mutex();
+		//! Waits until no other thread holds the lock, then takes it
+		void lock();
+		//! Releases one hold on the lock
+		void unlock();
+	private:
+		Mutex( const Mutex& ); // not copyable
+		void operator=( const Mutex& ); // not assignable
+		OPENGUI_MUTEX_HANDLE mHandle;
+	};
+
+	//! \internal Holds a Mutex locked for as long as it is in scope
+	class MutexLock {
+	public:
+		MutexLock( Mutex& mutex ): mMutex( mutex ) {
+			mMutex.lock();
+		}
+		~MutexLock() {
+			mMutex.unlock();
+		}
+	private:
+		void operator=( const MutexLock& ); // not assignable
+		Mutex& mMutex;
+	};
+
+	//! \internal Holds a Mutex locked for as long as it is in scope, when Screens can be drawn on several threads
+	/*! This guards state that is only shared between threads when OPENGUI_THREADED_UPDATE is
+	defined in OpenGUI_CONFIG.h. Otherwise it does nothing, so that single threaded builds
+	do not pay for a lock on every call. */
+#ifdef OPENGUI_THREADED_UPDATE
+	typedef MutexLock UpdateLock;
+#else
+	class UpdateLock {
+	public:
+		UpdateLock( Mutex& /*mutex*/ ) {}
+	};
+#endif
+
+	//! \internal Counting semaphore used to wake and wait for the threads of a WorkerPool
+	class OPENGUI_API Semaphore {
+	public:
+		Semaphore();
+		~Semaphore();
+		//! Adds \c count to the semaphore, releasing as many waiting threads
+		void post( unsigned int count = 1 );
+		//! Waits until the semaphore is above zero, then takes one from it
+		void wait();
+	private:
+		Semaphore( const Semaphore& ); // not copyable
+		void operator=( const Semaphore& ); // not assignable
+		OPENGUI_SEMAPHORE_HANDLE mHandle;
+	};
+
+	//! \internal Runs batches of jobs on a fixed set of worker threads
+	/*! The threads are started by the constructor and sleep between batches, so running
+	a batch only costs waking them. */
+	class OPENGUI_API WorkerPool {
+	public:
+		//! A unit of work given to WorkerPool::run()
+		class OPENGUI_API Job {
+		public:
+			virtual ~Job() {}
+			//! Performs the work. This is called from whichever thread of the pool takes the Job
+			virtual void run() = 0;
+		};
+		typedef std::vector<Job*> JobList;
+
+		//! Starts \c workerCount threads, which wait for work until the pool is destroyed
+		WorkerPool( unsigned int workerCount );
+		//! Stops and joins all of the worker threads
+		~WorkerPool();
+
+		//! Returns the number of worker threads, which does not include the thread calling run()
+		unsigned int getWorkerCount() const {
+			return ( unsigned int ) mThreads.size();
+		}
+
+		//! Runs every Job in \c jobs, returning once all of them have finished
+		/*! The calling thread works through the list alongside the workers. If any Job throws,
+		the rest are still run, and the first Exception is then thrown again from here. */
+		void run( const JobList& jobs );
+
+	private:
+		WorkerPool( const WorkerPool& ); // not copyable
+		void operator=( const WorkerPool& ); // not assignable
+
+		void _work(); // runs jobs from mJobs until none are left
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+		static unsigned int __stdcall _threadMain( void* pool );
+#elif OPENGUI_PLATFORM == OPENGUI_PLATFORM_LINUX
+		static void* _threadMain( void* pool );
+#endif
+
+		typedef std::vector<OPENGUI_THREAD_HANDLE> ThreadList;
+		ThreadList mThreads;
+		Semaphore mStart; // posted once per worker to start a batch, or to stop
+		Semaphore mDone; // posted by each worker when it runs out of jobs
+		Mutex mMutex; // guards mNextJob and mError
+		const JobList* mJobs; // the batch being run
+		size_t mNextJob; // index of the next Job to be taken
+		Exception* mError; // first Exception thrown by the current batch
+		bool mStop; // workers exit instead of running a batch
+	};
+
+} // namespace OpenGUI{
+
+#endif // E089FF81_7045_4788_A19F_FBC97CC78368
@@ -12,7 +12,7 @@
 namespace OpenGUI {
 
 	//! Timers provide a simple method of retrieving time deltas from the TimerManager.
-	class OPENGUI_API Timer {
+	class OPENGUI_API Timer: public RefCounted {
 	public:
 		//! Re-Syncs this Timer's internal time point marker with the TimerManager's current time.
 		void reset();
@@ -588,6 +588,19 @@ namespace OpenGUI {
 				return true;
 			return false;
 		}
+		//! return true if the given rect overlaps this rect
+		bool intersects( const FRect& rect ) const {
+			return rect.min.x < max.x && rect.max.x > min.x
+				   && rect.min.y < max.y && rect.max.y > min.y;
+		}
+		//! Grows this rect to also cover the given \c rect
+		FRect& merge( const FRect& rect ) {
+			if ( rect.min.x < min.x ) min.x = rect.min.x;
+			if ( rect.min.y < min.y ) min.y = rect.min.y;
+			if ( rect.max.x > max.x ) max.x = rect.max.x;
+			if ( rect.max.y > max.y ) max.y = rect.max.y;
+			return ( *this );
+		}
 		//! Return the given outer coord as an inner coord
 		/*! inner coord is defined as upper left = 0,0, lower right = 1.0f,1.0f */
 		FVector2 getInnerCoord( const FVector2& outerFVector2 ) {
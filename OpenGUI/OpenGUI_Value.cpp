@@ -14,63 +14,101 @@
 #include "OpenGUI_CursorManager.h"
 
 namespace OpenGUI {
+	// Compile time checks that the inline types fit within the 16 bytes of Value::mInline
+	typedef char FVector2_FitsInline[sizeof( FVector2 ) <= 16 ? 1 : -1];
+	typedef char FRect_FitsInline[sizeof( FRect ) <= 16 ? 1 : -1];
+	typedef char IVector2_FitsInline[sizeof( IVector2 ) <= 16 ? 1 : -1];
+	typedef char IRect_FitsInline[sizeof( IRect ) <= 16 ? 1 : -1];
+	typedef char Color_FitsInline[sizeof( Color ) <= 16 ? 1 : -1];
+	typedef char TextAlignment_FitsInline[sizeof( TextAlignment ) <= 16 ? 1 : -1];
 	//#####################################################################
 	void Value::constructor() {
 		mRaw = 0;
 		mHasValue = false;
 	}
 	//#####################################################################
-	Value::Value( const Value& copy ) {
+	/*! Inline types are copied by _copyInline(), and need no cleanup. */
+	bool Value::_isInline() const {
+		switch ( mType ) {
+		case T_BOOL:
+		case T_FLOAT:
+		case T_INTEGER:
+		case T_FVECTOR2:
+		case T_FRECT:
+		case T_IVECTOR2:
+		case T_IRECT:
+		case T_COLOR:
+		case T_TEXTALIGNMENT:
+			return true;
+		default:
+			return false;
+		}
+	}
+	//#####################################################################
+	/*! Copies the inline value held by \c copy as its own type, and takes on its type. */
+	void Value::_copyInline( const Value& copy ) {
+		switch ( copy.mType ) {
+		case T_BOOL:
+			mBool = copy.mBool;
+			break;
+		case T_FLOAT:
+			mFloat = copy.mFloat;
+			break;
+		case T_INTEGER:
+			mInt = copy.mInt;
+			break;
+		case T_FVECTOR2:
+			_setInline( copy._getInline<FVector2>() );
+			break;
+		case T_FRECT:
+			_setInline( copy._getInline<FRect>() );
+			break;
+		case T_IVECTOR2:
+			_setInline( copy._getInline<IVector2>() );
+			break;
+		case T_IRECT:
+			_setInline( copy._getInline<IRect>() );
+			break;
+		case T_COLOR:
+			_setInline( copy._getInline<Color>() );
+			break;
+		case T_TEXTALIGNMENT:
+			_setInline( copy._getInline<TextAlignment>() );
+			break;
+		default:
+			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Value type is not stored inline", __FUNCTION__ );
+		}
+		mType = copy.mType;
+		mHasValue = true;
+	}
+	//#####################################################################
+	Value::Value( const Value& copy ): mName( copy.mName ) {
 		constructor();
-		if ( copy.isSet() ) {
-			switch ( copy.getType() ) {
-			case T_BOOL:
-				setValue( copy.getValueAsBool() );
-				break;
-			case T_COLOR:
-				setValue( copy.getValueAsColor() );
-				break;
-			case T_FLOAT:
-				setValue( copy.getValueAsFloat() );
-				break;
-			case T_FRECT:
-				setValue( copy.getValueAsFRect() );
-				break;
-			case T_FVECTOR2:
-				setValue( copy.getValueAsFVector2() );
-				break;
-			case T_INTEGER:
-				setValue( copy.getValueAsInt() );
-				break;
-			case T_IRECT:
-				setValue( copy.getValueAsIRect() );
-				break;
-			case T_IVECTOR2:
-				setValue( copy.getValueAsIVector2() );
-				break;
-			case T_STRING:
-				setValue( copy.getValueAsString() );
-				break;
-			case T_FONT:
-				setValue( copy.getValueAsFont() );
-				break;
-			case T_TEXTALIGNMENT:
-				setValue( copy.getValueAsTextAlignment() );
-				break;
-			case T_IMAGERY:
-				setValue( copy.getValueAsImageryPtr() );
-				break;
-			case T_FACE:
-				setValue( copy.getValueAsFacePtr() );
-				break;
-			case T_CURSOR:
-				setValue( copy.getValueAsCursorPtr() );
-				break;
-			default:
-				OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Unknown type for source Value", __FUNCTION__ );
-			}
+		if ( !copy.isSet() )
+			return;
+		if ( copy._isInline() ) {
+			_copyInline( copy );
+			return;
+		}
+		switch ( copy.getType() ) {
+		case T_STRING:
+			setValue( *copy.mString );
+			break;
+		case T_FONT:
+			setValue( *copy.mFont );
+			break;
+		case T_IMAGERY:
+			setValue( *copy.mImageryPtr );
+			break;
+		case T_FACE:
+			setValue( *copy.mFacePtr );
+			break;
+		case T_CURSOR:
+			setValue( *copy.mCursorPtr );
+			break;
+		default:
+			OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Unknown type for source Value", __FUNCTION__ );
 		}
-		setName( copy.getName() );
 	}
 	//#####################################################################
 	Value::Value( const String& value, const String& Name ) {
@@ -205,113 +243,105 @@ namespace OpenGUI {
 	void Value::setValue( bool boolean ) {
 		clearValue();
 		mType = T_BOOL;
-		mBool = new bool;
-		*mBool = boolean;
+		mBool = boolean;
 		mHasValue = true;
 	}
 	//#####################################################################
 	bool Value::getValueAsBool() const {
 		if ( !isSet() || getType() != T_BOOL )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not a bool", __FUNCTION__ );
-		return *mBool;
+		return mBool;
 	}
 	//#####################################################################
 	void Value::setValue( float floatingPoint ) {
 		clearValue();
 		mType = T_FLOAT;
-		mFloat = new float;
-		*mFloat = floatingPoint;
+		mFloat = floatingPoint;
 		mHasValue = true;
 	}
 	//#####################################################################
 	float Value::getValueAsFloat() const {
 		if ( !isSet() || getType() != T_FLOAT )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not a float", __FUNCTION__ );
-		return *mFloat;
+		return mFloat;
 	}
 	//#####################################################################
 	void Value::setValue( const FVector2& floatVector ) {
 		clearValue();
 		mType = T_FVECTOR2;
-		mFVector2 = new FVector2();
-		*mFVector2 = floatVector;
+		_setInline( floatVector );
 		mHasValue = true;
 	}
 	//#####################################################################
 	FVector2 Value::getValueAsFVector2() const {
 		if ( !isSet() || getType() != T_FVECTOR2 )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not a FVector2", __FUNCTION__ );
-		return *mFVector2;
+		return _getInline<FVector2>();
 	}
 	//#####################################################################
 	void Value::setValue( const FRect& floatRect ) {
 		clearValue();
 		mType = T_FRECT;
-		mFRect = new FRect();
-		*mFRect = floatRect;
+		_setInline( floatRect );
 		mHasValue = true;
 	}
 	//#####################################################################
 	FRect Value::getValueAsFRect() const {
 		if ( !isSet() || getType() != T_FRECT )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not a FRect", __FUNCTION__ );
-		return *mFRect;
+		return _getInline<FRect>();
 	}
 	//#####################################################################
 	void Value::setValue( int integer ) {
 		clearValue();
 		mType = T_INTEGER;
-		mInt = new int;
-		*mInt = integer;
+		mInt = integer;
 		mHasValue = true;
 	}
 	//#####################################################################
 	int Value::getValueAsInt() const {
 		if ( !isSet() || getType() != T_INTEGER )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not an integer", __FUNCTION__ );
-		return *mInt;
+		return mInt;
 	}
 	//#####################################################################
 	void Value::setValue( const IVector2& intVector ) {
 		clearValue();
 		mType = T_IVECTOR2;
-		mIVector2 = new IVector2();
-		*mIVector2 = intVector;
+		_setInline( intVector );
 		mHasValue = true;
 	}
 	//#####################################################################
 	IVector2 Value::getValueAsIVector2() const {
 		if ( !isSet() || getType() != T_IVECTOR2 )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not an IVector2", __FUNCTION__ );
-		return *mIVector2;
+		return _getInline<IVector2>();
 	}
 	//#####################################################################
 	void Value::setValue( const IRect& intRect ) {
 		clearValue();
 		mType = T_IRECT;
-		mIRect = new IRect();
-		*mIRect = intRect;
+		_setInline( intRect );
 		mHasValue = true;
 	}
 	//#####################################################################
 	IRect Value::getValueAsIRect() const {
 		if ( !isSet() || getType() != T_IRECT )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not an IRect", __FUNCTION__ );
-		return *mIRect;
+		return _getInline<IRect>();
 	}
 	//#####################################################################
 	void Value::setValue( const Color& color ) {
 		clearValue();
 		mType = T_COLOR;
-		mColor = new Color();
-		*mColor = color;
+		_setInline( color );
 		mHasValue = true;
 	}
 	//#####################################################################
 	Color Value::getValueAsColor() const {
 		if ( !isSet() || getType() != T_COLOR )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not a Color", __FUNCTION__ );
-		return *mColor;
+		return _getInline<Color>();
 	}
 	//#####################################################################
 	void Value::setValueAsFont( const String& fontStr ) {
@@ -337,40 +367,15 @@ namespace OpenGUI {
 	void Value::clearValue() {
 		if ( isSet() ) {
 			mHasValue = false;
+			if ( _isInline() )
+				return; // nothing allocated
 			switch ( mType ) {
-			case T_BOOL:
-				if ( mBool ) delete mBool;
-				break;
-			case T_COLOR:
-				if ( mColor ) delete mColor;
-				break;
-			case T_FLOAT:
-				if ( mFloat ) delete mFloat;
-				break;
-			case T_FRECT:
-				if ( mFRect ) delete mFRect;
-				break;
-			case T_FVECTOR2:
-				if ( mFVector2 ) delete mFVector2;
-				break;
-			case T_INTEGER:
-				if ( mInt ) delete mInt;
-				break;
-			case T_IRECT:
-				if ( mIRect ) delete mIRect;
-				break;
-			case T_IVECTOR2:
-				if ( mIVector2 ) delete mIVector2;
-				break;
 			case T_STRING:
 				if ( mString ) delete mString;
 				break;
 			case T_FONT:
 				if ( mFont ) delete mFont;
 				break;
-			case T_TEXTALIGNMENT:
-				if ( mTextAlignment ) delete mTextAlignment;
-				break;
 			case T_IMAGERY:
 				if ( mImageryPtr ) delete mImageryPtr;
 				break;
@@ -393,50 +398,30 @@ namespace OpenGUI {
 	//#####################################################################
 	/*! If you want to create a complete clone, including the name, use the copy constructor. */
 	Value& Value::operator=( const Value& right ) {
+		if ( this == &right )
+			return *this;
+		if ( right.isSet() && right._isInline() ) {
+			clearValue();
+			_copyInline( right );
+			return *this;
+		}
 		clearValue();
 		if ( right.isSet() ) {
 			switch ( right.getType() ) {
-			case T_BOOL:
-				setValue( right.getValueAsBool() );
-				break;
-			case T_COLOR:
-				setValue( right.getValueAsColor() );
-				break;
-			case T_FLOAT:
-				setValue( right.getValueAsFloat() );
-				break;
-			case T_FRECT:
-				setValue( right.getValueAsFRect() );
-				break;
-			case T_FVECTOR2:
-				setValue( right.getValueAsFVector2() );
-				break;
-			case T_INTEGER:
-				setValue( right.getValueAsInt() );
-				break;
-			case T_IRECT:
-				setValue( right.getValueAsIRect() );
-				break;
-			case T_IVECTOR2:
-				setValue( right.getValueAsIVector2() );
-				break;
 			case T_STRING:
-				setValue( right.getValueAsString() );
+				setValue( *right.mString );
 				break;
 			case T_FONT:
-				setValue( right.getValueAsFont() );
-				break;
-			case T_TEXTALIGNMENT:
-				setValue( right.getValueAsTextAlignment() );
+				setValue( *right.mFont );
 				break;
 			case T_IMAGERY:
-				setValue( right.getValueAsImageryPtr() );
+				setValue( *right.mImageryPtr );
 				break;
 			case T_FACE:
-				setValue( right.getValueAsFacePtr() );
+				setValue( *right.mFacePtr );
 				break;
 			case T_CURSOR:
-				setValue( right.getValueAsCursorPtr() );
+				setValue( *right.mCursorPtr );
 				break;
 			default:
 				OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Unknown type for source Value", __FUNCTION__ );
@@ -464,46 +449,46 @@ namespace OpenGUI {
 
 		switch ( mType ) {
 		case T_BOOL:
-			return right.getValueAsBool() == ( *mBool );
+			return right.mBool == mBool;
 			break;
 		case T_COLOR:
-			return right.getValueAsColor() == ( *mColor );
+			return right._getInline<Color>() == _getInline<Color>();
 			break;
 		case T_FLOAT:
-			return right.getValueAsFloat() == ( *mFloat );
+			return right.mFloat == mFloat;
 			break;
 		case T_FRECT:
-			return right.getValueAsFRect() == ( *mFRect );
+			return right._getInline<FRect>() == _getInline<FRect>();
 			break;
 		case T_FVECTOR2:
-			return right.getValueAsFVector2() == ( *mFVector2 );
+			return right._getInline<FVector2>() == _getInline<FVector2>();
 			break;
 		case T_INTEGER:
-			return right.getValueAsInt() == ( *mInt );
+			return right.mInt == mInt;
 			break;
 		case T_IRECT:
-			return right.getValueAsIRect() == ( *mIRect );
+			return right._getInline<IRect>() == _getInline<IRect>();
 			break;
 		case T_IVECTOR2:
-			return right.getValueAsIVector2() == ( *mIVector2 );
+			return right._getInline<IVector2>() == _getInline<IVector2>();
 			break;
 		case T_STRING:
-			return right.getValueAsString() == ( *mString );
+			return *right.mString == *mString;
 			break;
 		case T_FONT:
-			return right.getValueAsFont() == ( *mFont );
+			return ( *mFont ) == *right.mFont;
 			break;
 		case T_TEXTALIGNMENT:
-			return right.getValueAsTextAlignment() == ( *mTextAlignment );
+			return right._getInline<TextAlignment>() == _getInline<TextAlignment>();
 			break;
 		case T_IMAGERY:
-			return right.getValueAsImageryPtr() == ( *mImageryPtr );
+			return *right.mImageryPtr == *mImageryPtr;
 			break;
 		case T_FACE:
-			return right.getValueAsFacePtr() == ( *mFacePtr );
+			return *right.mFacePtr == *mFacePtr;
 			break;
 		case T_CURSOR:
-			return right.getValueAsCursorPtr() == ( *mCursorPtr );
+			return *right.mCursorPtr == *mCursorPtr;
 			break;
 		default:
 			OG_THROW( Exception::ERR_NOT_IMPLEMENTED, "Comparison of type that is not implemented but should be!", __FUNCTION__ );
@@ -826,14 +811,14 @@ namespace OpenGUI {
 	void Value::setValue( const TextAlignment& textAlignment ) {
 		clearValue();
 		mType = T_TEXTALIGNMENT;
-		mTextAlignment = new TextAlignment( textAlignment );
+		_setInline( textAlignment );
 		mHasValue = true;
 	}
 	//#####################################################################
 	TextAlignment Value::getValueAsTextAlignment() const {
 		if ( !isSet() || getType() != T_TEXTALIGNMENT )
 			OG_THROW( Exception::OP_FAILED, "Stored value is not a TextAlignment", __FUNCTION__ );
-		return *mTextAlignment;
+		return _getInline<TextAlignment>();
 	}
 	//#####################################################################
 	void Value::setValueAsTextAlignment( const String& textAlignmentStr ) {
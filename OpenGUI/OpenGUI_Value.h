@@ -234,25 +234,36 @@ namespace OpenGUI {
 
 	private:
 		void constructor();
+		bool _isInline() const;
+		void _copyInline( const Value& copy );
 		bool mHasValue;
 		ValueType mType;
+		/* Small fixed size types are stored inline, in mInline, to avoid an allocation per
+		Value. Strings, Fonts and the RefPtr types are still stored on the heap.
+		mInline is plain bytes, aligned by the other members of the union. A value is constructed
+		in it as its own type, and only ever read back and copied as that type (see mType), so
+		integer types are never moved through float registers. */
 		union {
 			void* mRaw;
 			String* mString;
-			bool* mBool;
-			float* mFloat;
-			FVector2* mFVector2;
-			FRect* mFRect;
-			int* mInt;
-			IVector2* mIVector2;
-			IRect* mIRect;
-			Color* mColor;
 			Font* mFont;
-			TextAlignment* mTextAlignment;
 			ImageryPtr* mImageryPtr;
 			FacePtr* mFacePtr;
 			CursorPtr* mCursorPtr;
+			bool mBool;
+			float mFloat;
+			int mInt;
+			unsigned int mInlineAlign;
+			unsigned char mInline[16]; // holds FVector2, FRect, IVector2, IRect, Color, or TextAlignment
 		};
+		//! Constructs a copy of the given value in the inline storage, the inline types need no destruction
+		template<typename T> void _setInline( const T& value ) {
+			new( mInline ) T( value );
+		}
+		//! Returns the value held in the inline storage, which must have been stored as the given type
+		template<typename T> const T& _getInline() const {
+			return *reinterpret_cast<const T*>( mInline );
+		}
 		String mName;
 
 		static String _TypeToString( ValueType type );
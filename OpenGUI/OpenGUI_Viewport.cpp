@@ -9,7 +9,7 @@
 namespace OpenGUI {
 	//############################################################################
 	Viewport::Viewport() {
-		/**/
+		mUpdateArea = FRect( 0.0f, 0.0f, 1.0f, 1.0f );
 	}
 	//############################################################################
 	Viewport::~Viewport() {
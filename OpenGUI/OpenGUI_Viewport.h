@@ -21,6 +21,7 @@ namespace OpenGUI {
 	*/
 	class OPENGUI_API Viewport {
 		friend class Screen; // screen needs access to preUpdate/postUpdate
+		friend class RenderCommandBuffer; // calls preUpdate/postUpdate as a recorded update is submitted
 	public:
 		//! Set of Screen pointers, used to contain the list of Screens that are attached to a Viewport
 		typedef std::set<Screen*> ScreenSet;
@@ -30,6 +31,25 @@ namespace OpenGUI {
 		an accurate return value is very important. */
 		virtual const IVector2& getSize() = 0;
 
+		//! Should return \c true if the contents of this Viewport are kept from one update to the next
+		/*! When this returns \c true and only a single Screen draws to this Viewport,
+		the Screen only redraws the areas that have changed since its previous update.
+		The Renderer (or this Viewport in preUpdate()) must then clear only the area
+		given by getUpdateArea() rather than the entire Viewport, if it clears at all.
+		Viewports that are drawn over by anything other than their Screen, such as the
+		main window of an application, must not return \c true. The default is \c false.
+		*/
+		virtual bool retainsContents() {
+			return false;
+		}
+		//! Returns the area that the current update is redrawing
+		/*! The area is in the range 0.0f to 1.0f on both axes, with 0,0 at the upper left,
+		and is valid from Renderer::selectViewport() until the update completes. For Viewports
+		that do not retain their contents this is always the entire Viewport. */
+		const FRect& getUpdateArea() const {
+			return mUpdateArea;
+		}
+
 	protected:
 		//! constructor is protected to prevent unauthorized creation
 		Viewport();
@@ -69,6 +89,7 @@ namespace OpenGUI {
 
 	private:
 		ScreenSet mScreens;
+		FRect mUpdateArea; // set as each update is submitted
 		void _screenAttach( Screen* screen );
 		void _screenDetach( Screen* screen );
 	};
@@ -10,6 +10,30 @@
 #include "OpenGUI_StrConv.h"
 
 namespace OpenGUI {
+	// interned event names, so that dispatch is an index rather than a string lookup
+	static const EventID Event_Attached( "Attached" );
+	static const EventID Event_Detached( "Detached" );
+	static const EventID Event_Draw( "Draw" );
+	static const EventID Event_Invalidated( "Invalidated" );
+	static const EventID Event_CursorMoving( "CursorMoving" );
+	static const EventID Event_CursorMove( "CursorMove" );
+	static const EventID Event_CursorPressing( "CursorPressing" );
+	static const EventID Event_CursorPress( "CursorPress" );
+	static const EventID Event_CursorReleasing( "CursorReleasing" );
+	static const EventID Event_CursorRelease( "CursorRelease" );
+	static const EventID Event_CursorEnter( "CursorEnter" );
+	static const EventID Event_CursorLeave( "CursorLeave" );
+	static const EventID Event_CursorFocused( "CursorFocused" );
+	static const EventID Event_CursorFocusLost( "CursorFocusLost" );
+	static const EventID Event_Enabled( "Enabled" );
+	static const EventID Event_Disabled( "Disabled" );
+	static const EventID Event_KeyUp( "KeyUp" );
+	static const EventID Event_KeyDown( "KeyDown" );
+	static const EventID Event_KeyPressed( "KeyPressed" );
+	static const EventID Event_KeyFocused( "KeyFocused" );
+	static const EventID Event_KeyFocusLost( "KeyFocusLost" );
+	static const EventID Event_Tick( "Tick" );
+	//############################################################################
 	//############################################################################
 	class Widget_Name_ObjectProperty : public ObjectProperty {
 	public:
@@ -82,13 +106,19 @@ namespace OpenGUI {
 		~Widget_ObjectAccessorList() {}
 	}
 	gWidget_ObjectAccessorList;
+	ClassEventList gWidget_ClassEventList;
 
 	//############################################################################
 	//############################################################################
 
 
 	Widget::Widget() {
+		_addObjectKind( KIND_WIDGET );
 		mContainer = 0; //we always start with no container
+		mContainerPos = 0;
+		mCollectionPrev = 0;
+		mCollectionNext = 0;
+		mCollectionOwned = false;
 
 		if ( gWidget_ObjectAccessorList.getParent() == 0 )
 			gWidget_ObjectAccessorList.setParent( Object::getAccessors() );
@@ -100,55 +130,36 @@ namespace OpenGUI {
 		m_CursorInside = false;
 
 		//Set up events and default bindings
-		getEvents().createEvent( "Attached" );
-		getEvents().createEvent( "Detached" );
-		getEvents()["Attached"].add( new EventDelegate( this, &Widget::onAttached ) );
-		getEvents()["Detached"].add( new EventDelegate( this, &Widget::onDetached ) );
-
-		getEvents().createEvent( "Draw" );
-		getEvents().createEvent( "Invalidated" );
-		getEvents()["Draw"].add( new EventDelegate( this, &Widget::onDraw ) );
-		getEvents()["Invalidated"].add( new EventDelegate( this, &Widget::onInvalidated ) );
-
-		getEvents().createEvent( "CursorMoving" );
-		getEvents().createEvent( "CursorMove" );
-		getEvents().createEvent( "CursorPressing" );
-		getEvents().createEvent( "CursorPress" );
-		getEvents().createEvent( "CursorReleasing" );
-		getEvents().createEvent( "CursorRelease" );
-		getEvents().createEvent( "CursorEnter" );
-		getEvents().createEvent( "CursorLeave" );
-		getEvents().createEvent( "CursorFocused" );
-		getEvents().createEvent( "CursorFocusLost" );
-		getEvents()["CursorMoving"].add( new EventDelegate( this, &Widget::onCursorMoving ) );
-		getEvents()["CursorMove"].add( new EventDelegate( this, &Widget::onCursorMove ) );
-		getEvents()["CursorPressing"].add( new EventDelegate( this, &Widget::onCursorPressing ) );
-		getEvents()["CursorPress"].add( new EventDelegate( this, &Widget::onCursorPress ) );
-		getEvents()["CursorReleasing"].add( new EventDelegate( this, &Widget::onCursorReleasing ) );
-		getEvents()["CursorRelease"].add( new EventDelegate( this, &Widget::onCursorRelease ) );
-		getEvents()["CursorEnter"].add( new EventDelegate( this, &Widget::onCursorEnter ) );
-		getEvents()["CursorLeave"].add( new EventDelegate( this, &Widget::onCursorLeave ) );
-		getEvents()["CursorFocused"].add( new EventDelegate( this, &Widget::onCursorFocused ) );
-		getEvents()["CursorFocusLost"].add( new EventDelegate( this, &Widget::onCursorFocusLost ) );
-
-		getEvents().createEvent( "Enabled" );
-		getEvents().createEvent( "Disabled" );
-		getEvents()["Enabled"].add( new EventDelegate( this, &Widget::onEnabled ) );
-		getEvents()["Disabled"].add( new EventDelegate( this, &Widget::onDisabled ) );
-
-		getEvents().createEvent( "KeyUp" );
-		getEvents().createEvent( "KeyDown" );
-		getEvents().createEvent( "KeyPressed" );
-		getEvents().createEvent( "KeyFocused" );
-		getEvents().createEvent( "KeyFocusLost" );
-		getEvents()["KeyUp"].add( new EventDelegate( this, &Widget::onKeyUp ) );
-		getEvents()["KeyDown"].add( new EventDelegate( this, &Widget::onKeyDown ) );
-		getEvents()["KeyPressed"].add( new EventDelegate( this, &Widget::onKeyPressed ) );
-		getEvents()["KeyFocused"].add( new EventDelegate( this, &Widget::onKeyFocused ) );
-		getEvents()["KeyFocusLost"].add( new EventDelegate( this, &Widget::onKeyFocusLost ) );
-
-		getEvents().createEvent( "Tick" );
-		getEvents()["Tick"].add( new EventDelegate( this, &Widget::onTick ) );
+		if ( gWidget_ClassEventList.empty() ) {
+			gWidget_ClassEventList.addEvent( Event_Attached, &Widget::onAttached );
+			gWidget_ClassEventList.addEvent( Event_Detached, &Widget::onDetached );
+
+			gWidget_ClassEventList.addEvent( Event_Draw, &Widget::onDraw );
+			gWidget_ClassEventList.addEvent( Event_Invalidated, &Widget::onInvalidated );
+
+			gWidget_ClassEventList.addEvent( Event_CursorMoving, &Widget::onCursorMoving );
+			gWidget_ClassEventList.addEvent( Event_CursorMove, &Widget::onCursorMove );
+			gWidget_ClassEventList.addEvent( Event_CursorPressing, &Widget::onCursorPressing );
+			gWidget_ClassEventList.addEvent( Event_CursorPress, &Widget::onCursorPress );
+			gWidget_ClassEventList.addEvent( Event_CursorReleasing, &Widget::onCursorReleasing );
+			gWidget_ClassEventList.addEvent( Event_CursorRelease, &Widget::onCursorRelease );
+			gWidget_ClassEventList.addEvent( Event_CursorEnter, &Widget::onCursorEnter );
+			gWidget_ClassEventList.addEvent( Event_CursorLeave, &Widget::onCursorLeave );
+			gWidget_ClassEventList.addEvent( Event_CursorFocused, &Widget::onCursorFocused );
+			gWidget_ClassEventList.addEvent( Event_CursorFocusLost, &Widget::onCursorFocusLost );
+
+			gWidget_ClassEventList.addEvent( Event_Enabled, &Widget::onEnabled );
+			gWidget_ClassEventList.addEvent( Event_Disabled, &Widget::onDisabled );
+
+			gWidget_ClassEventList.addEvent( Event_KeyUp, &Widget::onKeyUp );
+			gWidget_ClassEventList.addEvent( Event_KeyDown, &Widget::onKeyDown );
+			gWidget_ClassEventList.addEvent( Event_KeyPressed, &Widget::onKeyPressed );
+			gWidget_ClassEventList.addEvent( Event_KeyFocused, &Widget::onKeyFocused );
+			gWidget_ClassEventList.addEvent( Event_KeyFocusLost, &Widget::onKeyFocusLost );
+
+			gWidget_ClassEventList.addEvent( Event_Tick, &Widget::onTick );
+		}
+		getEvents().setClassEvents( &gWidget_ClassEventList );
 	}
 	//############################################################################
 	Widget::~Widget() {
@@ -169,7 +180,10 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Widget::setName( const String& name ) {
+		WidgetCollection* container = getContainer();
 		if ( name == "" ) { // empty names (anonymous) are always ok
+			if ( container )
+				container->_notifyChildRename( this, name );
 			mWidgetName = name;
 			return;
 		}
@@ -178,13 +192,13 @@ namespace OpenGUI {
 			return;
 		}
 
-		WidgetCollection* container = getContainer();
 		if ( container ) {
 			Widget* w = container->getWidget( name );
 			if ( w && w != this ) {
 				OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Cannot assign name '" + name + "'. Current WidgetContainer holds another widget with the same name.", __FUNCTION__ );
 				return;
 			}
+			container->_notifyChildRename( this, name );
 		}
 		mWidgetName = name;
 	}
@@ -220,27 +234,58 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void Widget::invalidate() {
+		_damage();
+		_invalidateCache();
+	}
+	//############################################################################
+	/*! Used when the area this Widget covers has already been reported, such as when
+	a container is invalidated because one of its children was. */
+	void Widget::_invalidateCache() {
 		if ( mValid ) { // only trigger "Invalidated" once per invalidation period
 			mValid = false;
 			eventInvalidated();
-
-			Widget* parent = dynamic_cast<Widget*>( getParent() );
-			if ( parent )
-				parent->_invalidatedChild();
 		}
+		// the parent is told even if we were already invalid, as it may have cached our output since
+		// we were last drawn (we are never drawn while hidden, so would otherwise never tell it again).
+		// If it is still invalid itself and holds nothing current for us, it has already been told
+		// and passed that on, so there is no need to walk any further up.
+		Widget* parent = Widget::_cast( getParent() );
+		if ( parent && !( !parent->mValid && parent->_isChildCacheDirty( this ) ) )
+			parent->_invalidatedChild( this );
 	}
 	//############################################################################
-	void Widget::_invalidatedChild() {
+	void Widget::_invalidatedChild( Widget* /*child*/ ) {
 		/* Default does nothing */
 	}
 	//############################################################################
+	bool Widget::_isChildCacheDirty( Widget* /*child*/ ) const {
+		return false;
+	}
+	//############################################################################
 	void Widget::flush() {
-		Widget* parent = dynamic_cast<Widget*>( getParent() );
+		_damage();
+		Widget* parent = Widget::_cast( getParent() );
 		if ( parent )
-			parent->invalidate();
+			parent->_invalidatedChild( this ); // whatever the parent holds of us is stale, even if it is already invalid
 		_doflush();
 	}
 	//############################################################################
+	/*! Screens that only redraw what has changed rely on this to know what to redraw.
+	Widgets that do not report hit bounds cannot say what they cover, so they damage
+	the entire Screen. Does nothing when the Screen is going to redraw everything anyway. */
+	void Widget::_damage() {
+		Screen* screen = getScreen();
+		if ( !screen || !screen->_isTrackingDamage() )
+			return;
+		FRect bounds;
+		if ( !_getHitBounds( bounds ) ) {
+			screen->_damageAll();
+			return;
+		}
+		bounds.offset( pointToScreen( bounds.min ) - bounds.min );
+		screen->_damage( bounds );
+	}
+	//############################################################################
 	void Widget::_doflush() {
 		eventInvalidated();
 	}
@@ -265,12 +310,23 @@ namespace OpenGUI {
 		return true;
 	}
 	//############################################################################
+	/*! WidgetCollection uses this to build the spatial index that getChildAt() and
+	friends are answered from. Widgets that override isInside() must also override
+	this if their idea of "inside" reaches beyond what this reports, otherwise
+	they will not be found in those areas.
+
+	Widget implementation returns false, as isInside() is true everywhere.
+	*/
+	bool Widget::_getHitBounds( FRect& /*bounds*/ ) {
+		return false;
+	}
+	//############################################################################
 	Screen* Widget::getScreen() const {
 		if ( !mContainer ) return 0;
-		Widget* parentW = dynamic_cast<Widget*>( getParent() );
+		Widget* parentW = Widget::_cast( getParent() );
 		if ( parentW )
 			return parentW->getScreen();
-		Screen* parentS = dynamic_cast<Screen*>( getParent() );
+		Screen* parentS = Screen::_cast( getParent() );
 		if ( parentS )
 			return parentS;
 		return 0;
@@ -283,7 +339,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventAttached( WidgetCollection* newContainer, Widget* widget ) {
 		Attach_EventArgs event( newContainer, widget );
-		triggerEvent( "Attached", event );
+		triggerEvent( Event_Attached, event );
 	}
 	//############################################################################
 	void Widget::onDetached( Object* obj, Attach_EventArgs& evtArgs ) {
@@ -292,7 +348,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventDetached( WidgetCollection* prevContainer, Widget* widget ) {
 		Attach_EventArgs event( prevContainer, widget );
-		triggerEvent( "Detached", event );
+		triggerEvent( Event_Detached, event );
 	}
 	//############################################################################
 	void Widget::onDraw( Object* obj, Draw_EventArgs& evtArgs ) {
@@ -306,12 +362,12 @@ namespace OpenGUI {
 	void Widget::eventDraw( Brush& brush ) {
 		mValid = true;
 		Draw_EventArgs event( brush );
-		triggerEvent( "Draw", event );
+		triggerEvent( Event_Draw, event );
 	}
 	//############################################################################
 	void Widget::eventInvalidated() {
 		EventArgs event;
-		triggerEvent( "Invalidated", event );
+		triggerEvent( Event_Invalidated, event );
 	}
 	//############################################################################
 	//############################################################################
@@ -321,7 +377,7 @@ namespace OpenGUI {
 	*/
 	bool Widget::eventCursorMoving( float xPos, float yPos ) {
 		Cursor_EventArgs args( xPos, yPos );
-		triggerEvent( "CursorMoving", args );
+		triggerEvent( Event_CursorMoving, args );
 		return args.Consumed;
 	}
 	//############################################################################
@@ -341,7 +397,7 @@ namespace OpenGUI {
 	*/
 	bool Widget::eventCursorMove( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorMove", event );
+		triggerEvent( Event_CursorMove, event );
 		return event.Consumed;
 	}
 	//############################################################################
@@ -355,7 +411,7 @@ namespace OpenGUI {
 	*/
 	bool Widget::eventCursorPressing( float xPos, float yPos ) {
 		Cursor_EventArgs args( xPos, yPos );
-		triggerEvent( "CursorPressing", args );
+		triggerEvent( Event_CursorPressing, args );
 		return args.Consumed;
 	}
 	//############################################################################
@@ -375,7 +431,7 @@ namespace OpenGUI {
 	*/
 	bool Widget::eventCursorPress( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorPress", event );
+		triggerEvent( Event_CursorPress, event );
 		return event.Consumed;
 	}
 	//############################################################################
@@ -389,7 +445,7 @@ namespace OpenGUI {
 	*/
 	bool Widget::eventCursorReleasing( float xPos, float yPos ) {
 		Cursor_EventArgs args( xPos, yPos );
-		triggerEvent( "CursorReleasing", args );
+		triggerEvent( Event_CursorReleasing, args );
 		return args.Consumed;
 	}
 	//############################################################################
@@ -409,7 +465,7 @@ namespace OpenGUI {
 	*/
 	bool Widget::eventCursorRelease( float xPos, float yPos ) {
 		Cursor_EventArgs event( xPos, yPos );
-		triggerEvent( "CursorRelease", event );
+		triggerEvent( Event_CursorRelease, event );
 		return event.Consumed;
 	}
 	//############################################################################
@@ -419,7 +475,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventCursorEnter() {
 		EventArgs event;
-		triggerEvent( "CursorEnter", event );
+		triggerEvent( Event_CursorEnter, event );
 	}
 	//############################################################################
 	void Widget::onCursorEnter( Object* sender, EventArgs& evtArgs ) {
@@ -428,7 +484,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventCursorLeave() {
 		EventArgs event;
-		triggerEvent( "CursorLeave", event );
+		triggerEvent( Event_CursorLeave, event );
 	}
 	//############################################################################
 	void Widget::onCursorLeave( Object* sender, EventArgs& evtArgs ) {
@@ -437,7 +493,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventCursorFocused( Widget* cur, Widget* prev ) {
 		Focus_EventArgs event( cur, prev );
-		triggerEvent( "CursorFocused", event );
+		triggerEvent( Event_CursorFocused, event );
 	}
 	//############################################################################
 	void Widget::onCursorFocused( Object* sender, Focus_EventArgs& evtArgs ) {
@@ -446,7 +502,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventCursorFocusLost( Widget* cur, Widget* prev ) {
 		Focus_EventArgs event( cur, prev );
-		triggerEvent( "CursorFocusLost", event );
+		triggerEvent( Event_CursorFocusLost, event );
 	}
 	//############################################################################
 	void Widget::onCursorFocusLost( Object* sender, Focus_EventArgs& evtArgs ) {
@@ -456,7 +512,7 @@ namespace OpenGUI {
 	//############################################################################
 	bool Widget::eventKeyUp( char character ) {
 		Key_EventArgs event( character );
-		triggerEvent( "KeyUp", event );
+		triggerEvent( Event_KeyUp, event );
 		return event.Consumed;
 	}
 	//############################################################################
@@ -466,7 +522,7 @@ namespace OpenGUI {
 	//############################################################################
 	bool Widget::eventKeyDown( char character ) {
 		Key_EventArgs event( character );
-		triggerEvent( "KeyDown", event );
+		triggerEvent( Event_KeyDown, event );
 		return event.Consumed;
 	}
 	//############################################################################
@@ -476,7 +532,7 @@ namespace OpenGUI {
 	//############################################################################
 	bool Widget::eventKeyPressed( char character ) {
 		Key_EventArgs event( character );
-		triggerEvent( "KeyPressed", event );
+		triggerEvent( Event_KeyPressed, event );
 		return event.Consumed;
 	}
 	//############################################################################
@@ -486,7 +542,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventKeyFocused( Widget* cur, Widget* prev ) {
 		Focus_EventArgs event( cur, prev );
-		triggerEvent( "KeyFocused", event );
+		triggerEvent( Event_KeyFocused, event );
 	}
 	//############################################################################
 	void Widget::onKeyFocused( Object* sender, Focus_EventArgs& evtArgs ) {
@@ -495,7 +551,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventKeyFocusLost( Widget* cur, Widget* prev ) {
 		Focus_EventArgs event( cur, prev );
-		triggerEvent( "KeyFocusLost", event );
+		triggerEvent( Event_KeyFocusLost, event );
 	}
 	//############################################################################
 	void Widget::onKeyFocusLost( Object* sender, Focus_EventArgs& evtArgs ) {
@@ -505,7 +561,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventEnabled() {
 		EventArgs event;
-		triggerEvent( "Enabled", event );
+		triggerEvent( Event_Enabled, event );
 	}
 	//############################################################################
 	void Widget::onEnabled( Object* sender, EventArgs& evtArgs ) {
@@ -514,7 +570,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventDisabled() {
 		EventArgs event;
-		triggerEvent( "Disabled", event );
+		triggerEvent( Event_Disabled, event );
 	}
 	//############################################################################
 	void Widget::onDisabled( Object* sender, EventArgs& evtArgs ) {
@@ -603,7 +659,7 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::eventTick( float seconds ) {
 		Tick_EventArgs event( seconds );
-		triggerEvent( "Tick", event );
+		triggerEvent( Event_Tick, event );
 	}
 	//############################################################################
 	void Widget::onTick( Object* sender, Tick_EventArgs& evtArgs ) {
@@ -644,38 +700,39 @@ namespace OpenGUI {
 			return screen->getPath( tmpPath );
 		}
 
-		StringList pathList;
-		StrConv::tokenize( tmpPath, pathList, '/' );
-		return _getPath( pathList );
+		return _getPath( tmpPath, 0 );
 	}
 	//############################################################################
-	Widget* Widget::_getPath( StringList& pathList ) const {
-		if ( pathList.size() == 0 ) return const_cast<Widget*>( this );
+	/*! Each call resolves one segment and hands the rest of the path to the next
+	object, so the path is never split up front. */
+	Widget* Widget::_getPath( const String& path, String::size_type start ) const {
+		if ( start == String::npos ) return const_cast<Widget*>( this );
 
-		const String top = pathList.front();
-		pathList.pop_front();
+		const String::size_type end = path.find( '/', start );
+		const String top = path.substr( start, end == String::npos ? String::npos : end - start );
+		const String::size_type next = end == String::npos ? String::npos : end + 1;
 		if ( !( top.length() > 0 ) ) {
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Empty path locations are not allowed", __FUNCTION__ );
 			return 0;
 		}
 		if ( top == "." ) {
-			return _getPath( pathList );
+			return _getPath( path, next );
 		}
 		if ( top == ".." ) {
-			Widget* parent = dynamic_cast<Widget*>( getParent() );
+			Widget* parent = Widget::_cast( getParent() );
 			if ( parent ) {
-				return parent->_getPath( pathList );
+				return parent->_getPath( path, next );
 			}
-			Screen* screen = dynamic_cast<Screen*>( getParent() );
+			Screen* screen = Screen::_cast( getParent() );
 			if ( screen ) {
-				return screen->_getPath( pathList );
+				return screen->_getPath( path, next );
 			}
 			OG_THROW( Exception::OP_FAILED, "Unknown container type. Cannot proceed to parent path", __FUNCTION__ );
 		}
 
 		Widget* child = _getChildByName( top );
 		if ( child ) {
-			return child->_getPath( pathList );
+			return child->_getPath( path, next );
 		}
 		return 0;
 	}
@@ -716,7 +773,7 @@ namespace OpenGUI {
 	//############################################################################
 	FVector2 Widget::pointToScreen( const FVector2& local_point ) {
 		FVector2 point = local_point;
-		Widget* parent = dynamic_cast<Widget*>( getParent() );
+		Widget* parent = Widget::_cast( getParent() );
 		if ( parent ) {
 			parent->_doPointToScreen( point );
 		}
@@ -725,7 +782,7 @@ namespace OpenGUI {
 	//############################################################################
 	FVector2 Widget::pointFromScreen( const FVector2& screen_point ) {
 		FVector2 point = screen_point;
-		Widget* parent = dynamic_cast<Widget*>( getParent() );
+		Widget* parent = Widget::_cast( getParent() );
 		if ( parent ) {
 			parent->_doPointFromScreen( point );
 		}
@@ -734,14 +791,14 @@ namespace OpenGUI {
 	//############################################################################
 	void Widget::_doPointToScreen( FVector2& local_point ) {
 		_translatePointOut( local_point );
-		Widget* parent = dynamic_cast<Widget*>( getParent() );
+		Widget* parent = Widget::_cast( getParent() );
 		if ( parent ) {
 			parent->_doPointToScreen( local_point );
 		}
 	}
 	//############################################################################
 	void Widget::_doPointFromScreen( FVector2& screen_point ) {
-		Widget* parent = dynamic_cast<Widget*>( getParent() );
+		Widget* parent = Widget::_cast( getParent() );
 		if ( parent ) {
 			parent->_doPointFromScreen( screen_point );
 		}
@@ -908,6 +965,14 @@ namespace OpenGUI {
 		}
 	}
 	//############################################################################
+	/*! Containers only route cursor events to the children that are under the
+	cursor and the children that report \c true here, so widgets that hold children
+	of their own must also report \c true while any of those children do.
+	ContainerControl already does so. */
+	bool Widget::_isCursorEngaged() {
+		return m_CursorInside;
+	}
+	//############################################################################
 	void Widget::_injectCursorFocused( Widget* next, Widget* prev ) {
 		assert( next == this );
 		eventCursorFocused( next, prev );
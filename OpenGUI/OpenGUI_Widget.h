@@ -80,6 +80,8 @@ namespace OpenGUI {
 
 		//! invalidate this Widget, as well as any and all potential children
 		void flush();
+		//! \internal Reports the area covered by this Widget to its Screen as needing to be redrawn
+		void _damage();
 		//! Needs to be overridden by container widgets to invalidate self and call _doFlush() for all children
 		virtual void _doflush();
 
@@ -102,8 +104,8 @@ namespace OpenGUI {
 
 		//! Returns a pointer to the widget at the given path, 0 if no widget is found
 		Widget* getPath( const String& path ) const;
-		//! \internal follows the given \c pathList, returning the ending location. The \c pathList is modified along the way
-		Widget* _getPath( StringList& pathList ) const;
+		//! \internal follows the remainder of \c path from the segment starting at \c start, returning the ending location. \c start is String::npos when no segments remain
+		Widget* _getPath( const String& path, String::size_type start ) const;
 
 		//! Translates the given point from coordinates local to this Widget into Screen level coordinates
 		FVector2 pointToScreen( const FVector2& local_point );
@@ -128,9 +130,15 @@ namespace OpenGUI {
 		//Object Functions
 		virtual ObjectAccessorList* getAccessors();
 		virtual unsigned int getObjectType() const;
+		//! Returns \c object as a Widget, or 0 if it is not one. Equivalent to, but much cheaper than, \c dynamic_cast<Widget*>
+		static Widget* _cast( Object* object ) {
+			return object && object->isKindOf( KIND_WIDGET ) ? static_cast<Widget*>( object ) : 0;
+		}
 
 		//! Returns true if the given point is inside this Widget
 		virtual bool isInside( const FVector2& position );
+		//! \internal Fills \c bounds with the area outside of which isInside() never returns true. Returns \c false if there is no such limit.
+		virtual bool _getHitBounds( FRect& bounds );
 
 		//! Informs this widget of cursor movement
 		void _injectCursorMove( Cursor_EventArgs& moveEvent );
@@ -144,6 +152,8 @@ namespace OpenGUI {
 		void _injectCursorRelease( Cursor_EventArgs& releaseEvent );
 		//! Should inject the CursorRelease event to all children
 		virtual void _sendToChildren_CursorRelease( Cursor_EventArgs& releaseEvent );
+		//! \internal Returns \c true if this Widget or any of its children consider the cursor to be inside them
+		virtual bool _isCursorEngaged();
 		//! Informs this widget of cursor focus acquisition
 		void _injectCursorFocused( Widget* next, Widget* prev );
 		//! Informs this widget of cursor focus loss
@@ -291,10 +301,22 @@ namespace OpenGUI {
 		//! \internal returns the child with the given name. Virtual so that container widgets can redefine it to fit their storage type. Default returns 0 always
 		virtual Widget* _getChildByName( const String& childName ) const;
 
-		//! \internal called by a child when they have been invalidated. Default does nothing. Override me if you need more functionality
-		virtual void _invalidatedChild();
+		//! \internal called by a \c child whenever it has been invalidated. Default does nothing. Override me if you need more functionality
+		virtual void _invalidatedChild( Widget* child );
+		//! \internal returns \c true if nothing this Widget has cached for the \c child is current. Default returns \c false, so children always report their invalidations
+		virtual bool _isChildCacheDirty( Widget* child ) const;
+		//! \internal Same as invalidate(), but without reporting any area of the Screen as needing to be redrawn
+		void _invalidateCache();
+		//! \internal Marks this Widget as drawn, so that its next invalidation is reported. eventDraw() does this for Widgets that draw themselves
+		void _validate() {
+			mValid = true;
+		}
 	private:
 		WidgetCollection* mContainer; // <- managed by WidgetCollection. We should never touch this.
+		unsigned int mContainerPos; // <- position within mContainer as of its last spatial index build, managed by WidgetCollection
+		Widget* mCollectionPrev; // <- neighbours within mContainer, managed by WidgetCollection
+		Widget* mCollectionNext;
+		bool mCollectionOwned; // <- true if mContainer deletes us on destruction, managed by WidgetCollection
 		bool mValid; // used to prevent multiple calls to invalidate from constantly causing Invalidated events
 
 		bool mEnabled;
@@ -5,19 +5,70 @@
 #include "OpenGUI_WidgetCollection.h"
 #include "OpenGUI_Exception.h"
 #include "OpenGUI_Widget.h"
+#include "OpenGUI_Event.h"
 
 
 namespace OpenGUI {
+	// collections smaller than this are just scanned, since the index would cost more than it saves
+	static const size_t INDEX_MIN_WIDGETS = 32;
+	// upper limit on the number of grid cells along either axis
+	static const unsigned int INDEX_MAX_CELLS = 64;
+
+	// Returns the grid cell that the given offset from the grid origin falls in.
+	// Points on or past the far edge are clamped into the last cell.
+	static inline unsigned int IndexCell( float offset, float scale, unsigned int count ) {
+		const int cell = ( int )( offset * scale );
+		if ( cell < 0 ) return 0;
+		if (( unsigned int )cell >= count ) return count - 1;
+		return ( unsigned int )cell;
+	}
+
+	// Walks two ascending index lists as if they were one, so that candidates
+	// are visited in collection order. Either list may be 0.
+	class IndexMerge {
+	public:
+		typedef std::vector<unsigned int> IndexList;
+		IndexMerge( const IndexList* a, const IndexList* b ): mA( a ), mB( b ), mPosA( 0 ), mPosB( 0 ) {}
+		bool next( unsigned int& index ) {
+			const bool haveA = mA && mPosA < mA->size();
+			const bool haveB = mB && mPosB < mB->size();
+			if ( haveA && ( !haveB || ( *mA )[mPosA] < ( *mB )[mPosB] ) ) {
+				index = ( *mA )[mPosA++];
+				return true;
+			}
+			if ( haveB ) {
+				index = ( *mB )[mPosB++];
+				return true;
+			}
+			return false;
+		}
+	private:
+		const IndexList* mA;
+		const IndexList* mB;
+		size_t mPosA;
+		size_t mPosB;
+	};
+
+	// running total of cursor event deliveries, read by Screen for its statistics
+	static unsigned int gCursorDispatchCount = 0;
+
 	//############################################################################
 	WidgetCollection::WidgetCollection() {
 		mParent = 0;
+		mFirst = 0;
+		mLast = 0;
+		mCount = 0;
+		mIndexDirty = true;
+		mIndexCols = 0;
+		mIndexRows = 0;
+		mIndexMaxSpan = 0;
+		mCursorDispatch = 0;
 	}
 	//############################################################################
 	WidgetCollection::~WidgetCollection() {
-		while ( mCollectionObjects.size() > 0 ) {
-			WidgetCollectionItem* ptr = mCollectionObjects.front();
-			bool own = ptr->own;
-			Widget* w = ptr->widgetPtr;
+		while ( mFirst ) {
+			Widget* w = mFirst;
+			bool own = w->mCollectionOwned;
 			remove( w );
 			if ( own )
 				delete w;
@@ -25,11 +76,8 @@ namespace OpenGUI {
 	}
 	//############################################################################
 	void WidgetCollection::appendWidgetPtrList( WidgetPtrList& l ) const {
-		WidgetCollectionItemPtrList::const_iterator i, ie = mCollectionObjects.end();
-		for ( i = mCollectionObjects.begin(); i != ie; i++ ) {
-			WidgetCollectionItem* item = ( *i );
-			l.push_back( item->widgetPtr );
-		}
+		for ( Widget* w = mFirst; w; w = w->mCollectionNext )
+			l.push_back( w );
 	}
 	//############################################################################
 	/*! \warning Do not take this operation lightly. Stealing ownership of WidgetCollections
@@ -86,14 +134,12 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Invalid Widget pointer: 0", __FUNCTION__ );
 		if ( widget->mContainer )
 			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Cannot add a widget to more than 1 WidgetCollection", __FUNCTION__ );
-		const String wName = widget->getName();
-		if ( wName != "" ) {
-			Widget* w = getWidget( wName );
-			if ( w )
-				OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Cannot have more than 1 widget with same name per container: " + wName, __FUNCTION__ );
-		}
+		const String& wName = widget->getName();
+		if ( wName != "" && getWidget( wName ) )
+			OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Cannot have more than 1 widget with same name per container: " + wName, __FUNCTION__ );
 		_add_front( widget, takeOwnership );
 		_fireWidgetAdded( widget );
+		widget->_damage();
 	}
 	//############################################################################
 	void WidgetCollection::add_back( Widget* widget, bool takeOwnership ) {
@@ -101,14 +147,12 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_INVALIDPARAMS, "Invalid Widget pointer: 0", __FUNCTION__ );
 		if ( widget->mContainer )
 			OG_THROW( Exception::ERR_INTERNAL_ERROR, "Cannot add a widget to more than 1 WidgetCollection", __FUNCTION__ );
-		const String wName = widget->getName();
-		if ( wName != "" ) {
-			Widget* w = getWidget( wName );
-			if ( w )
-				OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Cannot have more than 1 widget with same name per container: " + wName, __FUNCTION__ );
-		}
+		const String& wName = widget->getName();
+		if ( wName != "" && getWidget( wName ) )
+			OG_THROW( Exception::ERR_DUPLICATE_ITEM, "Cannot have more than 1 widget with same name per container: " + wName, __FUNCTION__ );
 		_add_back( widget, takeOwnership );
 		_fireWidgetAdded( widget );
+		widget->_damage();
 	}
 	//############################################################################
 	/*! If the collection was told to take ownership of the requested widget,
@@ -118,70 +162,114 @@ namespace OpenGUI {
 	\throw Exception if the widget is not part of this collection
 	*/
 	void WidgetCollection::remove( Widget* widget ) {
+		if ( hasWidget( widget ) )
+			widget->_damage(); // the area it leaves behind must be redrawn
 		_remove( widget );
+		std::vector<Widget*>::iterator iter = std::find( mCursorTracked.begin(), mCursorTracked.end(), widget );
+		if ( iter != mCursorTracked.end() )
+			mCursorTracked.erase( iter );
+		for ( CursorDispatch* dispatch = mCursorDispatch; dispatch; dispatch = dispatch->prev )
+			std::replace( dispatch->targets.begin(), dispatch->targets.end(), widget, ( Widget* )0 );
 		_fireWidgetRemoved( widget );
 	}
 	//############################################################################
 	void WidgetCollection::_add_front( Widget* widget, bool takeOwnership ) {
-		WidgetCollectionItem* ptr = new WidgetCollectionItem;
-		ptr->own = takeOwnership;
-		ptr->widgetPtr = widget;
+		widget->mCollectionOwned = takeOwnership;
 		widget->mContainer = this;
-		mCollectionObjects.push_front( ptr );
+		_link_front( widget );
+		if ( widget->getName() != "" )
+			mNameIndex[widget->getName()] = widget;
+		mIndexDirty = true;
 	}
 	//############################################################################
 	void WidgetCollection::_add_back( Widget* widget, bool takeOwnership ) {
-		WidgetCollectionItem* ptr = new WidgetCollectionItem;
-		ptr->own = takeOwnership;
-		ptr->widgetPtr = widget;
+		widget->mCollectionOwned = takeOwnership;
 		widget->mContainer = this;
-		mCollectionObjects.push_back( ptr );
+		_link_back( widget );
+		if ( widget->getName() != "" )
+			mNameIndex[widget->getName()] = widget;
+		mIndexDirty = true;
+	}
+	//############################################################################
+	void WidgetCollection::_link_front( Widget* widget ) {
+		widget->mCollectionPrev = 0;
+		widget->mCollectionNext = mFirst;
+		if ( mFirst )
+			mFirst->mCollectionPrev = widget;
+		else
+			mLast = widget;
+		mFirst = widget;
+		mCount++;
+	}
+	//############################################################################
+	void WidgetCollection::_link_back( Widget* widget ) {
+		widget->mCollectionNext = 0;
+		widget->mCollectionPrev = mLast;
+		if ( mLast )
+			mLast->mCollectionNext = widget;
+		else
+			mFirst = widget;
+		mLast = widget;
+		mCount++;
+	}
+	//############################################################################
+	void WidgetCollection::_unlink( Widget* widget ) {
+		if ( widget->mCollectionPrev )
+			widget->mCollectionPrev->mCollectionNext = widget->mCollectionNext;
+		else
+			mFirst = widget->mCollectionNext;
+		if ( widget->mCollectionNext )
+			widget->mCollectionNext->mCollectionPrev = widget->mCollectionPrev;
+		else
+			mLast = widget->mCollectionPrev;
+		widget->mCollectionPrev = 0;
+		widget->mCollectionNext = 0;
+		mCount--;
 	}
 	//############################################################################
 	bool WidgetCollection::hasWidget( Widget* widget ) {
-		for ( WidgetCollectionItemPtrList::iterator iter = mCollectionObjects.begin();
-				iter != mCollectionObjects.end(); iter++ ) {
-			WidgetCollectionItem* ptr = ( *iter );
-			if ( widget == ptr->widgetPtr )
-				return true;
-		}
-		return false;
+		return widget && widget->mContainer == this;
+	}
+	//############################################################################
+	size_t WidgetCollection::size() const {
+		return mCount;
 	}
 	//############################################################################
 	void WidgetCollection::_remove( Widget* widget ) {
-		for ( WidgetCollectionItemPtrList::iterator iter = mCollectionObjects.begin();
-				iter != mCollectionObjects.end(); iter++ ) {
-			WidgetCollectionItem* ptr = ( *iter );
-			if ( widget == ptr->widgetPtr ) {
-				widget->mContainer = 0;
-				mCollectionObjects.erase( iter );
-				return;
-			}
-		}
-		OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Widget not found in WidgetCollection", __FUNCTION__ );
+		if ( !hasWidget( widget ) )
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Widget not found in WidgetCollection", __FUNCTION__ );
+		_unlink( widget );
+		if ( widget->getName() != "" )
+			mNameIndex.erase( widget->getName() );
+		widget->mContainer = 0;
+		widget->mCollectionOwned = false;
+		mIndexDirty = true;
 	}
 	//############################################################################
+	/*! Moving only relinks the widget, so it keeps its ownership and its name entry. */
 	void WidgetCollection::moveToFront( Widget* widget ) {
-		bool owner = getWidgetHolder( widget )->own;
-		_remove( widget );
-		_add_front( widget, owner );
+		if ( !hasWidget( widget ) )
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Widget not found in WidgetCollection", __FUNCTION__ );
+		_unlink( widget );
+		_link_front( widget );
+		mIndexDirty = true;
+		widget->_damage();
 	}
 	//############################################################################
 	void WidgetCollection::moveToBack( Widget* widget ) {
-		bool owner = getWidgetHolder( widget )->own;
-		_remove( widget );
-		_add_back( widget, owner );
+		if ( !hasWidget( widget ) )
+			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Widget not found in WidgetCollection", __FUNCTION__ );
+		_unlink( widget );
+		_link_back( widget );
+		mIndexDirty = true;
+		widget->_damage();
 	}
 	//############################################################################
 	Widget* WidgetCollection::getWidget( const String& widgetName ) const {
-		for ( WidgetCollectionItemPtrList::const_iterator iter = mCollectionObjects.begin();
-				iter != mCollectionObjects.end(); iter++ ) {
-			WidgetCollectionItem* ptr = ( *iter );
-			if ( ptr && ptr->widgetPtr && widgetName == ptr->widgetPtr->getName() ) {
-				return ptr->widgetPtr;
-			}
-		}
-		return 0;
+		NameIndex::const_iterator iter = mNameIndex.find( widgetName );
+		if ( iter == mNameIndex.end() )
+			return 0;
+		return iter->second;
 	}
 	//############################################################################
 	Widget& WidgetCollection::operator[]( const String& widgetName ) {
@@ -193,39 +281,357 @@ namespace OpenGUI {
 		return *widget;
 	}
 	//############################################################################
-	WidgetCollection::WidgetCollectionItem* WidgetCollection::getWidgetHolder( Widget* widget ) {
-		for ( WidgetCollectionItemPtrList::iterator iter = mCollectionObjects.begin();
-				iter != mCollectionObjects.end(); iter++ ) {
-			WidgetCollectionItem* ptr = ( *iter );
-			if ( widget == ptr->widgetPtr ) {
-				return ptr;
+	/*! The caller has already ensured that \c newName is not in use by another widget. */
+	void WidgetCollection::_notifyChildRename( Widget* widget, const String& newName ) {
+		if ( widget->getName() != "" )
+			mNameIndex.erase( widget->getName() );
+		if ( newName != "" )
+			mNameIndex[newName] = widget;
+	}
+	//############################################################################
+	Widget* WidgetCollection::_step( Widget* widget, bool forward ) const {
+		if ( !widget )
+			return forward ? mFirst : mLast;
+		return forward ? widget->mCollectionNext : widget->mCollectionPrev;
+	}
+	//############################################################################
+	/*! If the widget's new hit bounds still fall within the area the index was built over,
+	only the cells it occupies are updated. Anything else throws the index out. */
+	void WidgetCollection::_notifyChildBoundsChanged( Widget* widget ) {
+		if ( mIndexDirty || mIndexOrder.empty() )
+			return; // nothing to keep up to date
+		if ( !_reindexWidget( widget ) )
+			mIndexDirty = true;
+	}
+	//############################################################################
+	static inline void IndexRemove( std::vector<unsigned int>& list, unsigned int i ) {
+		std::vector<unsigned int>::iterator iter = std::lower_bound( list.begin(), list.end(), i );
+		if ( iter != list.end() && *iter == i )
+			list.erase( iter );
+	}
+	//############################################################################
+	static inline void IndexInsert( std::vector<unsigned int>& list, unsigned int i ) {
+		std::vector<unsigned int>::iterator iter = std::lower_bound( list.begin(), list.end(), i );
+		if ( iter == list.end() || *iter != i )
+			list.insert( iter, i ); // lists stay sorted by collection position
+	}
+	//############################################################################
+	void WidgetCollection::_getIndexSpan( const FRect& r, unsigned int& c0, unsigned int& c1, unsigned int& r0, unsigned int& r1 ) const {
+		c0 = IndexCell( r.min.x - mIndexBounds.min.x, mIndexCellScale.x, mIndexCols );
+		c1 = IndexCell( r.max.x - mIndexBounds.min.x, mIndexCellScale.x, mIndexCols );
+		r0 = IndexCell( r.min.y - mIndexBounds.min.y, mIndexCellScale.y, mIndexRows );
+		r1 = IndexCell( r.max.y - mIndexBounds.min.y, mIndexCellScale.y, mIndexRows );
+	}
+	//############################################################################
+	/*! Returns false if the widget can no longer be filed without rebuilding the index,
+	in which case the index is left as it was. */
+	bool WidgetCollection::_reindexWidget( Widget* widget ) {
+		const unsigned int i = widget->mContainerPos;
+		if ( i >= mIndexOrder.size() || mIndexOrder[i] != widget )
+			return false;
+
+		// work out where the widget belongs now
+		FRect bounds;
+		char kind;
+		if ( !widget->_getHitBounds( bounds ) ) {
+			kind = INDEX_UNBOUNDED;
+		} else if ( bounds.getWidth() <= 0.0f || bounds.getHeight() <= 0.0f ) {
+			kind = INDEX_NOWHERE;
+		} else {
+			if ( mIndexCols == 0 || mIndexBounds.getWidth() <= 0.0f || mIndexBounds.getHeight() <= 0.0f )
+				return false; // nothing was bounded at build time, so there is no grid to file into
+			if ( bounds.min.x < mIndexBounds.min.x || bounds.min.y < mIndexBounds.min.y ||
+					bounds.max.x > mIndexBounds.max.x || bounds.max.y > mIndexBounds.max.y )
+				return false; // outside the grid
+			kind = INDEX_CELLS;
+		}
+		unsigned int c0, c1, r0, r1;
+		if ( kind == INDEX_CELLS ) {
+			_getIndexSpan( bounds, c0, c1, r0, r1 );
+			if (( size_t )( c1 - c0 + 1 ) * ( r1 - r0 + 1 ) > mIndexMaxSpan )
+				kind = INDEX_UNBOUNDED;
+		}
+
+		// take it out of wherever it was filed
+		if ( mIndexKinds[i] == INDEX_UNBOUNDED ) {
+			IndexRemove( mIndexUnbounded, i );
+		} else if ( mIndexKinds[i] == INDEX_CELLS ) {
+			unsigned int oc0, oc1, or0, or1;
+			_getIndexSpan( mIndexRects[i], oc0, oc1, or0, or1 );
+			for ( unsigned int row = or0; row <= or1; row++ )
+				for ( unsigned int col = oc0; col <= oc1; col++ )
+					IndexRemove( mIndexCells[row * mIndexCols + col], i );
+		}
+
+		// and file it again
+		mIndexKinds[i] = kind;
+		if ( kind == INDEX_UNBOUNDED ) {
+			IndexInsert( mIndexUnbounded, i );
+		} else if ( kind == INDEX_CELLS ) {
+			mIndexRects[i] = bounds;
+			for ( unsigned int row = r0; row <= r1; row++ )
+				for ( unsigned int col = c0; col <= c1; col++ )
+					IndexInsert( mIndexCells[row * mIndexCols + col], i );
+		}
+		return true;
+	}
+	//############################################################################
+	void WidgetCollection::_buildIndex() {
+		mIndexDirty = false;
+		mIndexOrder.clear();
+		for ( size_t i = 0; i < mIndexCells.size(); i++ )
+			mIndexCells[i].clear(); // keep the allocations, the next layout will likely fill them the same way
+		mIndexUnbounded.clear();
+		mIndexKinds.clear();
+		mIndexRects.clear();
+		mIndexCols = 0;
+		mIndexRows = 0;
+		mIndexMaxSpan = 0;
+		if ( mCount < INDEX_MIN_WIDGETS )
+			return; // leave the index empty, queries will scan the list instead
+
+		// gather the hit bounds of every widget, and the area they cover as a whole
+		const size_t count = mCount;
+		mIndexOrder.reserve( count );
+		std::vector<FRect> bounds( count );
+		enum { HIT_EVERYWHERE, HIT_BOUNDED, HIT_NOWHERE };
+		std::vector<char> bounded( count, HIT_EVERYWHERE );
+		size_t boundedCount = 0;
+		for ( Widget* widget = mFirst; widget; widget = widget->mCollectionNext ) {
+			const size_t i = mIndexOrder.size();
+			widget->mContainerPos = ( unsigned int )i;
+			mIndexOrder.push_back( widget );
+			if ( !widget->_getHitBounds( bounds[i] ) ) {
+				bounded[i] = HIT_EVERYWHERE;
+				continue;
+			}
+			if ( bounds[i].getWidth() <= 0.0f || bounds[i].getHeight() <= 0.0f ) {
+				bounded[i] = HIT_NOWHERE; // empty bounds
+				continue;
+			}
+			bounded[i] = HIT_BOUNDED;
+			if ( boundedCount++ == 0 ) {
+				mIndexBounds = bounds[i];
+			} else {
+				if ( bounds[i].min.x < mIndexBounds.min.x ) mIndexBounds.min.x = bounds[i].min.x;
+				if ( bounds[i].min.y < mIndexBounds.min.y ) mIndexBounds.min.y = bounds[i].min.y;
+				if ( bounds[i].max.x > mIndexBounds.max.x ) mIndexBounds.max.x = bounds[i].max.x;
+				if ( bounds[i].max.y > mIndexBounds.max.y ) mIndexBounds.max.y = bounds[i].max.y;
+			}
+		}
+		if ( boundedCount == 0 )
+			mIndexBounds = FRect( 0.0f, 0.0f, 0.0f, 0.0f );
+
+		// aim for roughly one widget per cell
+		unsigned int side = ( unsigned int ) sqrtf(( float ) boundedCount );
+		if ( side < 1 ) side = 1;
+		if ( side > INDEX_MAX_CELLS ) side = INDEX_MAX_CELLS;
+		mIndexCols = side;
+		mIndexRows = side;
+		mIndexCells.resize( mIndexCols * mIndexRows );
+		if ( boundedCount > 0 ) {
+			mIndexCellScale.x = ( float ) mIndexCols / mIndexBounds.getWidth();
+			mIndexCellScale.y = ( float ) mIndexRows / mIndexBounds.getHeight();
+		}
+		mIndexMaxSpan = mIndexCells.size() < 16 ? mIndexCells.size() : mIndexCells.size() / 4;
+		mIndexKinds.assign( count, ( char )INDEX_NOWHERE );
+		mIndexRects.swap( bounds ); // kept for _reindexWidget()
+
+		// bucket each widget in the order it appears in the collection, so every list stays sorted
+		for ( unsigned int i = 0; i < ( unsigned int ) count; i++ ) {
+			if ( bounded[i] == HIT_NOWHERE )
+				continue;
+			if ( bounded[i] == HIT_EVERYWHERE ) {
+				mIndexKinds[i] = INDEX_UNBOUNDED;
+				mIndexUnbounded.push_back( i );
+				continue;
+			}
+			unsigned int c0, c1, r0, r1;
+			_getIndexSpan( mIndexRects[i], c0, c1, r0, r1 );
+			if (( size_t )( c1 - c0 + 1 ) * ( r1 - r0 + 1 ) > mIndexMaxSpan ) {
+				mIndexKinds[i] = INDEX_UNBOUNDED;
+				mIndexUnbounded.push_back( i ); // cheaper to just test this one every time
+				continue;
+			}
+			mIndexKinds[i] = INDEX_CELLS;
+			for ( unsigned int row = r0; row <= r1; row++ )
+				for ( unsigned int col = c0; col <= c1; col++ )
+					mIndexCells[row * mIndexCols + col].push_back( i );
+		}
+	}
+	//############################################################################
+	void WidgetCollection::_getIndexCandidates( const FVector2& position, const IndexList*& cell, const IndexList*& unbounded ) {
+		unbounded = &mIndexUnbounded;
+		cell = 0;
+		if ( !mIndexBounds.isInside( position ) )
+			return; // no bounded widget can contain the position
+		const unsigned int col = IndexCell( position.x - mIndexBounds.min.x, mIndexCellScale.x, mIndexCols );
+		const unsigned int row = IndexCell( position.y - mIndexBounds.min.y, mIndexCellScale.y, mIndexRows );
+		cell = &mIndexCells[row * mIndexCols + col];
+	}
+	//############################################################################
+	/*! The spatial index is rebuilt here if anything has changed since the last query,
+	so the first query after a layout pass pays for the rebuild. */
+	Widget* WidgetCollection::getWidgetAt( const FVector2& position ) {
+		if ( mIndexDirty )
+			_buildIndex();
+		if ( mIndexOrder.empty() ) {
+			for ( Widget* widget = mFirst; widget; widget = widget->mCollectionNext ) {
+				if ( widget->isInside( position ) )
+					return widget;
+			}
+			return 0;
+		}
+
+		const IndexList* cell;
+		const IndexList* unbounded;
+		_getIndexCandidates( position, cell, unbounded );
+		IndexMerge candidates( cell, unbounded );
+		unsigned int i;
+		while ( candidates.next( i ) ) {
+			Widget* widget = mIndexOrder[i];
+			if ( widget->isInside( position ) )
+				return widget;
+		}
+		return 0;
+	}
+	//############################################################################
+	void WidgetCollection::getWidgetsAt( const FVector2& position, WidgetPtrList& outList ) {
+		if ( mIndexDirty )
+			_buildIndex();
+		if ( mIndexOrder.empty() ) {
+			for ( Widget* widget = mFirst; widget; widget = widget->mCollectionNext ) {
+				if ( widget->isInside( position ) )
+					outList.push_back( widget );
+			}
+			return;
+		}
+
+		const IndexList* cell;
+		const IndexList* unbounded;
+		_getIndexCandidates( position, cell, unbounded );
+		IndexMerge candidates( cell, unbounded );
+		unsigned int i;
+		while ( candidates.next( i ) ) {
+			Widget* widget = mIndexOrder[i];
+			if ( widget->isInside( position ) )
+				outList.push_back( widget );
+		}
+	}
+	//############################################################################
+	bool WidgetCollection::_isTracked( Widget* widget ) const {
+		return std::find( mCursorTracked.begin(), mCursorTracked.end(), widget ) != mCursorTracked.end();
+	}
+	//############################################################################
+	void WidgetCollection::_trackCursor( Widget* widget ) {
+		if ( !_isTracked( widget ) )
+			mCursorTracked.push_back( widget );
+	}
+	//############################################################################
+	bool WidgetCollection::_isCursorEngaged() const {
+		return !mCursorTracked.empty();
+	}
+	//############################################################################
+	unsigned int WidgetCollection::_getCursorDispatchCount() {
+		return gCursorDispatchCount;
+	}
+	//############################################################################
+	void WidgetCollection::_getCursorTargets( const FVector2& position, std::vector<Widget*>& outList ) {
+		if ( mIndexDirty )
+			_buildIndex();
+		if ( mIndexOrder.empty() ) {
+			for ( Widget* widget = mFirst; widget; widget = widget->mCollectionNext ) {
+				if ( widget->isInside( position ) || _isTracked( widget ) )
+					outList.push_back( widget );
 			}
+			return;
 		}
-		OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "Widget not found in WidgetCollection", __FUNCTION__ );
+
+		IndexList order;
+		const IndexList* cell;
+		const IndexList* unbounded;
+		_getIndexCandidates( position, cell, unbounded );
+		IndexMerge candidates( cell, unbounded );
+		unsigned int i;
+		while ( candidates.next( i ) ) {
+			if ( mIndexOrder[i]->isInside( position ) )
+				order.push_back( i );
+		}
+		if ( !mCursorTracked.empty() ) {
+			// fold in the tracked widgets by their position, so everything is still visited in collection order
+			for ( size_t t = 0; t < mCursorTracked.size(); t++ )
+				order.push_back( mCursorTracked[t]->mContainerPos );
+			std::sort( order.begin(), order.end() );
+			order.erase( std::unique( order.begin(), order.end() ), order.end() );
+		}
+		outList.reserve( order.size() );
+		for ( size_t o = 0; o < order.size(); o++ )
+			outList.push_back( mIndexOrder[order[o]] );
+	}
+	//############################################################################
+	/*! Moves are delivered to every target even once consumed, so that those further
+	down can issue their CursorLeave. Presses and releases stop at the first consumer,
+	as nothing past it would act on them anyway. */
+	void WidgetCollection::_dispatchCursor( Cursor_EventArgs& evtArgs, CursorInjector inject, bool isMove ) {
+		CursorDispatch dispatch;
+		_getCursorTargets( evtArgs.Position, dispatch.targets );
+		if ( dispatch.targets.empty() )
+			return;
+		dispatch.prev = mCursorDispatch;
+		mCursorDispatch = &dispatch;
+		try {
+			for ( size_t i = 0; i < dispatch.targets.size(); i++ ) {
+				if ( !isMove && evtArgs.Consumed )
+					break;
+				Widget* widget = dispatch.targets[i];
+				if ( !widget )
+					continue; // removed by an earlier handler
+				gCursorDispatchCount++;
+				( widget->*inject )( evtArgs );
+				if ( !isMove || !dispatch.targets[i] )
+					continue;
+				// keep following the widget for as long as it thinks the cursor is inside it (or one of its children)
+				if ( widget->_isCursorEngaged() ) {
+					_trackCursor( widget );
+				} else {
+					std::vector<Widget*>::iterator iter = std::find( mCursorTracked.begin(), mCursorTracked.end(), widget );
+					if ( iter != mCursorTracked.end() )
+						mCursorTracked.erase( iter );
+				}
+			}
+		} catch ( ... ) {
+			mCursorDispatch = dispatch.prev;
+			throw;
+		}
+		mCursorDispatch = dispatch.prev;
+	}
+	//############################################################################
+	void WidgetCollection::_injectCursorMove( Cursor_EventArgs& moveEvent ) {
+		_dispatchCursor( moveEvent, &Widget::_injectCursorMove, true );
+	}
+	//############################################################################
+	void WidgetCollection::_injectCursorPress( Cursor_EventArgs& pressEvent ) {
+		_dispatchCursor( pressEvent, &Widget::_injectCursorPress, false );
+	}
+	//############################################################################
+	void WidgetCollection::_injectCursorRelease( Cursor_EventArgs& releaseEvent ) {
+		_dispatchCursor( releaseEvent, &Widget::_injectCursorRelease, false );
 	}
 	//############################################################################
 	WidgetCollection::iterator WidgetCollection::begin() {
-		WidgetCollection::iterator iter;
-		iter.mIter = mCollectionObjects.begin();
-		return iter;
+		return iterator( this, mFirst );
 	}
 	//############################################################################
 	WidgetCollection::iterator WidgetCollection::end() {
-		WidgetCollection::iterator iter;
-		iter.mIter = mCollectionObjects.end();
-		return iter;
+		return iterator( this, 0 );
 	}
 	//############################################################################
 	WidgetCollection::reverse_iterator WidgetCollection::rbegin() {
-		WidgetCollection::reverse_iterator iter;
-		iter.mIter = mCollectionObjects.rbegin();
-		return iter;
+		return reverse_iterator( this, mLast );
 	}
 	//############################################################################
 	WidgetCollection::reverse_iterator WidgetCollection::rend() {
-		WidgetCollection::reverse_iterator iter;
-		iter.mIter = mCollectionObjects.rend();
-		return iter;
+		return reverse_iterator( this, 0 );
 	}
 	//############################################################################
 } // namespace OpenGUI {
@@ -9,11 +9,13 @@
 #include "OpenGUI_Exports.h"
 #include "OpenGUI_String.h"
 #include "OpenGUI_Types.h"
+#include "OpenGUI_HashMap.h"
 #include "OpenGUI_WidgetCollectionListener.h"
 
 namespace OpenGUI {
 	class Widget; // forward declaration
 	class Object; // forward declaration
+	class Cursor_EventArgs; // forward declaration
 	typedef std::list<Widget*> WidgetPtrList; // forward declaration
 
 	//! Ordered collection of Widget objects.
@@ -27,12 +29,6 @@ namespace OpenGUI {
 		typedef std::set<WidgetCollectionListener*> ListenerSet;
 		ListenerSet mListeners;
 
-		struct OPENGUI_API WidgetCollectionItem {
-			WidgetCollectionItem()
-					: widgetPtr( 0 ), own( false ) {}
-			Widget* widgetPtr;
-			bool own;
-		};
 		void _fireWidgetAdded( Widget* widget );
 		void _fireWidgetRemoved( Widget* widget );
 
@@ -45,11 +41,64 @@ namespace OpenGUI {
 		//! automatically called by Widget during destruction to notify us so we can remove its entry
 		void _notifyChildDelete( Widget* widgetToRemove );
 
-		typedef std::list<WidgetCollectionItem*> WidgetCollectionItemPtrList;
-		WidgetCollectionItemPtrList mCollectionObjects;
-		WidgetCollectionItem* getWidgetHolder( Widget* widget );
+		//! called by Widget::setName() before the name of a widget in this collection changes
+		void _notifyChildRename( Widget* widget, const String& newName );
+
+		// The widgets are kept in a list that is linked through the widgets themselves
+		// (Widget::mCollectionPrev/mCollectionNext), so adds and removes do not allocate.
+		void _link_front( Widget* widget );
+		void _link_back( Widget* widget );
+		void _unlink( Widget* widget );
+		Widget* mFirst;
+		Widget* mLast;
+		size_t mCount;
+
+		// named widgets by name, for getWidget() and the duplicate name checks
+		typedef HashMap<String, Widget*> NameIndex;
+		NameIndex mNameIndex;
 		Object* mParent;
 
+		// Spatial index used to answer getWidgetAt()/getWidgetsAt(). The collection is
+		// bucketed into a uniform grid of cells by each widget's hit bounds, and every
+		// cell lists the widgets that overlap it by their position in the collection.
+		// Widgets without hit bounds, or that cover too much of the grid to be worth
+		// bucketing, are kept in mIndexUnbounded and tested for every query.
+		// Changes to the collection throw the index out, and it is only rebuilt on the
+		// next query. A widget moving within the indexed area just has its cells updated.
+		typedef std::vector<unsigned int> IndexList;
+		void _buildIndex();
+		bool _reindexWidget( Widget* widget );
+		void _getIndexSpan( const FRect& r, unsigned int& c0, unsigned int& c1, unsigned int& r0, unsigned int& r1 ) const;
+		void _getIndexCandidates( const FVector2& position, const IndexList*& cell, const IndexList*& unbounded );
+		bool mIndexDirty;
+		std::vector<Widget*> mIndexOrder; // collection order at the time the index was built
+		std::vector<IndexList> mIndexCells;
+		IndexList mIndexUnbounded;
+		// how each widget was filed by the last build or reindex, by position in mIndexOrder
+		enum IndexKind { INDEX_NOWHERE, INDEX_CELLS, INDEX_UNBOUNDED };
+		std::vector<char> mIndexKinds;
+		std::vector<FRect> mIndexRects; // the hit bounds a widget in INDEX_CELLS was bucketed by
+		size_t mIndexMaxSpan; // cell count past which a widget goes to mIndexUnbounded instead
+		FRect mIndexBounds;
+		FVector2 mIndexCellScale; // converts an offset from mIndexBounds.min into cell coordinates
+		unsigned int mIndexCols;
+		unsigned int mIndexRows;
+
+		// Cursor routing. Cursor events are delivered to the widgets under the cursor,
+		// and to the widgets that were still engaged with the cursor after the last move
+		// they received, so that those can see the cursor leave.
+		typedef void ( Widget::*CursorInjector )( Cursor_EventArgs& );
+		void _dispatchCursor( Cursor_EventArgs& evtArgs, CursorInjector inject, bool isMove );
+		void _getCursorTargets( const FVector2& position, std::vector<Widget*>& outList );
+		bool _isTracked( Widget* widget ) const;
+		std::vector<Widget*> mCursorTracked;
+		// a dispatch in progress, kept so that widgets removed by event handlers can be dropped from it
+		struct CursorDispatch {
+			std::vector<Widget*> targets;
+			CursorDispatch* prev;
+		};
+		CursorDispatch* mCursorDispatch;
+
 	public:
 		//! public constructor
 		WidgetCollection();
@@ -74,6 +123,8 @@ namespace OpenGUI {
 
 		//! returns true if the given widget pointer is in the collection
 		bool hasWidget( Widget* widget );
+		//! returns the number of widgets in the collection
+		size_t size() const;
 
 		//! Attaches a WidgetCollectionListener to this WidgetCollection
 		void attachListener( WidgetCollectionListener* listener );
@@ -88,72 +139,101 @@ namespace OpenGUI {
 		//! Appends the contents of this collection to the end of the given WidgetPtrList, preserving the collection's order
 		void appendWidgetPtrList( WidgetPtrList& l ) const;
 
+		//! Returns the first widget in collection order that contains the given \c position, or 0 if none do
+		/*! Each candidate is tested with Widget::isInside(), so \c position must be given in
+		the coordinate space the widgets in this collection are placed in. */
+		Widget* getWidgetAt( const FVector2& position );
+		//! Appends every widget that contains the given \c position to \c outList, preserving the collection's order
+		void getWidgetsAt( const FVector2& position, WidgetPtrList& outList );
+		//! \internal Called by widgets within this collection when their hit bounds have changed
+		void _notifyChildBoundsChanged( Widget* widget );
+
+		//! \internal Delivers a cursor move to the widgets under the cursor, and those still engaged with it
+		void _injectCursorMove( Cursor_EventArgs& moveEvent );
+		//! \internal Delivers a cursor press to the widgets under the cursor, and those still engaged with it
+		void _injectCursorPress( Cursor_EventArgs& pressEvent );
+		//! \internal Delivers a cursor release to the widgets under the cursor, and those still engaged with it
+		void _injectCursorRelease( Cursor_EventArgs& releaseEvent );
+		//! \internal Ensures the given widget receives the next cursor move, even if it is not under the cursor
+		void _trackCursor( Widget* widget );
+		//! \internal Returns \c true if any widget in this collection is engaged with the cursor
+		bool _isCursorEngaged() const;
+		//! \internal Returns the running total of cursor event deliveries made by all collections
+		static unsigned int _getCursorDispatchCount();
+
+		//! \internal Returns the widget after (or before, if \c forward is \c false) \c widget. Stepping from 0 returns the first (or last) widget.
+		Widget* _step( Widget* widget, bool forward ) const;
+
 		//! Template class providing iterator encapsulation
-		template <typename IterType>
+		template <bool REVERSE>
 		class collection_iterator {
 			friend class WidgetCollection;
 		public:
-			collection_iterator() {}
+			collection_iterator(): mCollection( 0 ), mWidget( 0 ) {}
 			collection_iterator( const collection_iterator& copy ) {
-				mIter = copy.mIter;
+				mCollection = copy.mCollection;
+				mWidget = copy.mWidget;
 			}
 			//! Equality comparison. Iterators are equal when they point to the same object
 			bool operator==( const collection_iterator& right ) {
-				return mIter == right.mIter;
+				return mWidget == right.mWidget;
 			}
 			//! Not Equal comparison
 			bool operator!=( const collection_iterator& right ) {
-				return mIter != right.mIter;
+				return mWidget != right.mWidget;
 			}
 			//! Assign the iterator value from another iterator
 			collection_iterator& operator=( const collection_iterator& right ) {
-				mIter = right.mIter;
+				mCollection = right.mCollection;
+				mWidget = right.mWidget;
 				return *this;
 			}
 			//! Move to next
 			collection_iterator operator++( int ) {
 				collection_iterator t( *this );
-				++mIter;
+				mWidget = mCollection->_step( mWidget, !REVERSE );
 				return t;
 			}
 			//! Move to previous
 			collection_iterator operator--( int ) {
 				collection_iterator t( *this );
-				--mIter;
+				mWidget = mCollection->_step( mWidget, REVERSE );
 				return t;
 			}
 			//! Move to next
 			collection_iterator& operator++() {
-				++mIter;
+				mWidget = mCollection->_step( mWidget, !REVERSE );
 				return *this;
 			}
 			//! Move to previous
 			collection_iterator& operator--() {
-				--mIter;
+				mWidget = mCollection->_step( mWidget, REVERSE );
 				return *this;
 			}
 			//! Returns the widget at iterator by reference
 			Widget& operator*() {
-				return *(( *mIter )->widgetPtr );
+				return *mWidget;
 			}
 			//! Returns a pointer to the widget at iterator
 			Widget* operator->() {
-				return (( *mIter )->widgetPtr );
+				return mWidget;
 			}
 			//! Returns a pointer to the widget at iterator
 			Widget* get() {
-				return (( *mIter )->widgetPtr );
+				return mWidget;
 			}
 
 		private:
-			IterType mIter;
+			collection_iterator( const WidgetCollection* collection, Widget* widget ): mCollection( collection ), mWidget( widget ) {}
+			const WidgetCollection* mCollection;
+			Widget* mWidget; // 0 when off the end
 		};
 
 		//! WidgetCollection iterator
-		typedef collection_iterator<WidgetCollectionItemPtrList::iterator> iterator;
+		typedef collection_iterator<false> iterator;
 
 		//! WidgetCollection reverse_iterator
-		typedef collection_iterator<WidgetCollectionItemPtrList::reverse_iterator> reverse_iterator;
+		typedef collection_iterator<true> reverse_iterator;
 
 		iterator begin(); //!< returns an iterator for the collection starting at the beginning
 		iterator end(); //!< returns an iterator for the collection starting off the end
@@ -144,6 +144,7 @@ namespace OpenGUI {
 		wd.Name = BaseName;
 		wd.Library = BaseLibrary;
 		wd.Properties = propertyList;
+		wd.Handles.clear();
 	}
 	//############################################################################
 	void WidgetManager::UndefineWidget( const String& Name ) {
@@ -160,11 +161,16 @@ namespace OpenGUI {
 			OG_THROW( Exception::ERR_ITEM_NOT_FOUND, "No Widget defined with given Name: " + Name, __FUNCTION__ );
 		WidgetDefinition& wd = iter->second;
 		Widget* widget = CreateRawWidget( wd.Name, wd.Library );
-		ValueList proplist = wd.Properties;
-		while ( proplist.size() > 0 ) {
-			Value val = proplist.pop_front();
+		const size_t propCount = wd.Properties.size();
+		if ( wd.Handles.size() != propCount )
+			wd.Handles.assign( propCount, PropertyHandle() );
+		for ( size_t i = 0; i < propCount; i++ ) {
+			Value val = wd.Properties.get(( unsigned int ) i );
 			if ( val.getName().length() > 0 ) {
-				widget->setProperty( val.getName(), val );
+				PropertyHandle& handle = wd.Handles[i];
+				if ( !handle.isValid() )
+					handle = widget->resolveProperty( val.getName() );
+				widget->setProperty( handle, val );
 			}
 		}
 		return widget;
@@ -282,13 +288,13 @@ namespace OpenGUI {
 		for ( XMLNodeList::iterator iter = childNodes.begin(); iter != childNodes.end(); iter++ ) {
 			XMLNode* child = ( *iter );
 			if ( child->getTagName() == "Widget" ) {
-				ContainerControl* container = dynamic_cast<ContainerControl*>( widget );
+				ContainerControl* container = ContainerControl::_cast( widget );
 				if ( !container )
 					OG_THROW( Exception::OP_FAILED, "Failure casting this <Widget> into a proper container for child: " + widgetNode.dump(), __FUNCTION__ );
 				else
 					_Widget_XMLNode_IntoContainer( *child, container->Children );
 			} else if ( child->getTagName() == "Form" ) {
-				ContainerControl* container = dynamic_cast<ContainerControl*>( widget );
+				ContainerControl* container = ContainerControl::_cast( widget );
 				if ( !container )
 					OG_THROW( Exception::OP_FAILED, "Failure casting this <Widget> into a proper container for child: " + widgetNode.dump(), __FUNCTION__ );
 				else {
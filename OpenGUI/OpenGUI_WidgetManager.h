@@ -10,6 +10,7 @@
 #include "OpenGUI_String.h"
 #include "OpenGUI_Singleton.h"
 #include "OpenGUI_Value.h"
+#include "OpenGUI_Object.h"
 #include "OpenGUI_XML.h"
 
 namespace OpenGUI {
@@ -76,6 +77,7 @@ namespace OpenGUI {
 			String Name;
 			String Library;
 			ValueList Properties;
+			std::vector<PropertyHandle> Handles; // Properties resolved by index, filled on first creation
 		};
 		typedef std::map<String, WidgetDefinition> WidgetDefinitionMap;
 		WidgetDefinitionMap mWidgetDefinitionMap;
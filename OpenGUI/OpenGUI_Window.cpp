@@ -6,6 +6,11 @@
 #include "OpenGUI_Screen.h"
 
 namespace OpenGUI {
+	static const EventID Event_Move_Begin( "Move_Begin" );
+	static const EventID Event_Move_End( "Move_End" );
+	static const EventID Event_Resize_Begin( "Resize_Begin" );
+	static const EventID Event_Resize_End( "Resize_End" );
+	//############################################################################
 
 	class Window_ObjectAccessorList : public ObjectAccessorList {
 	public:
@@ -15,6 +20,7 @@ namespace OpenGUI {
 		~Window_ObjectAccessorList() {}
 	}
 	gWindow_ObjectAccessorList;
+	ClassEventList gWindow_ClassEventList;
 
 	//############################################################################
 	//############################################################################
@@ -29,14 +35,14 @@ namespace OpenGUI {
 		m_Resizing = RS_NONE;
 
 		//Set up events and default bindings
-		getEvents().createEvent( "Move_Begin" );
-		getEvents().createEvent( "Move_End" );
-		getEvents().createEvent( "Resize_Begin" );
-		getEvents().createEvent( "Resize_End" );
-		getEvents()["Move_Begin"].add( new EventDelegate( this, &Window::onMove_Begin ) );
-		getEvents()["Move_End"].add( new EventDelegate( this, &Window::onMove_End ) );
-		getEvents()["Resize_Begin"].add( new EventDelegate( this, &Window::onResize_Begin ) );
-		getEvents()["Resize_End"].add( new EventDelegate( this, &Window::onResize_End ) );
+		if ( gWindow_ClassEventList.empty() ) {
+			gWindow_ClassEventList.setParent( getEvents().getClassEvents() );
+			gWindow_ClassEventList.addEvent( Event_Move_Begin, &Window::onMove_Begin );
+			gWindow_ClassEventList.addEvent( Event_Move_End, &Window::onMove_End );
+			gWindow_ClassEventList.addEvent( Event_Resize_Begin, &Window::onResize_Begin );
+			gWindow_ClassEventList.addEvent( Event_Resize_End, &Window::onResize_End );
+		}
+		getEvents().setClassEvents( &gWindow_ClassEventList );
 	}
 	//############################################################################
 	Window::~Window() {
@@ -53,12 +59,12 @@ namespace OpenGUI {
 	//############################################################################
 	void Window::eventMove_Begin() {
 		EventArgs event;
-		triggerEvent( "Move_Begin", event );
+		triggerEvent( Event_Move_Begin, event );
 	}
 	//############################################################################
 	void Window::eventMove_End() {
 		EventArgs event;
-		triggerEvent( "Move_End", event );
+		triggerEvent( Event_Move_End, event );
 	}
 	//############################################################################
 	/*! The reversal arguments allow you to control how the cursor affects the
@@ -67,12 +73,12 @@ namespace OpenGUI {
 	side to remain stationary. */
 	void Window::eventResize_Begin( bool sizeHeight , bool sizeWidth , bool revWidth , bool revHeight ) {
 		WindowResizeBeginEventArgs event( sizeHeight, revHeight, sizeWidth, revWidth );
-		triggerEvent( "Resize_Begin", event );
+		triggerEvent( Event_Resize_Begin, event );
 	}
 	//############################################################################
 	void Window::eventResize_End() {
 		EventArgs event;
-		triggerEvent( "Resize_End", event );
+		triggerEvent( Event_Resize_End, event );
 	}
 	//############################################################################
 	void Window::onMove_Begin( Object* sender, EventArgs& evtArgs ) {
@@ -0,0 +1,106 @@
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Adaptive cache policy benchmark
+// Three ContainerControls of CHILDREN children each: one that never changes, one
+// where a single child changes every frame, and one where every child moves every
+// frame. Each is best served by a different cache policy, so the same frames are
+// run with each fixed policy applied to all three, and then with CacheAuto, which
+// should settle on the best policy for each container.
+
+const int CHILDREN = 50;
+const int FRAMES = 1000;
+
+// a Control that draws its rect
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		evtArgs.brush.Primitive.drawRect( getRect() );
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+ContainerControl* CreatePanel( Screen* screen, float top ) {
+	ContainerControl* panel = new ContainerControl;
+	panel->setTop( top );
+	panel->setWidth( 800.0f );
+	panel->setHeight( 200.0f );
+	screen->Children.add_back( panel, true );
+	for ( int i = 0; i < CHILDREN; i++ ) {
+		Control* tile = new TileControl;
+		tile->setLeft(( float )( i % 25 ) * 32.0f );
+		tile->setTop(( float )( i / 25 ) * 24.0f );
+		tile->setWidth( 30.0f );
+		tile->setHeight( 22.0f );
+		panel->Children.add_back( tile, true );
+	}
+	return panel;
+}
+
+const char* PolicyName( int policy ) {
+	switch ( policy ) {
+	case ContainerControl::CacheAuto:
+		return "Auto";
+	case ContainerControl::CacheNone:
+		return "None";
+	case ContainerControl::CacheMemory:
+		return "Memory";
+	case ContainerControl::CacheRTT:
+		return "RTT";
+	}
+	return "?";
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "AdaptiveCache", FVector2( 800, 600 ), &viewport );
+
+	ContainerControl* panels[3];
+	panels[0] = CreatePanel( screen, 0.0f ); // static
+	panels[1] = CreatePanel( screen, 200.0f ); // one child changes
+	panels[2] = CreatePanel( screen, 400.0f ); // every child moves
+	const int expected[3] = { ContainerControl::CacheRTT, ContainerControl::CacheMemory, ContainerControl::CacheNone };
+
+	std::cout << "3 panels of " << CHILDREN << " children, " << FRAMES << " frames" << std::endl;
+	const int policies[4] = { ContainerControl::CacheNone, ContainerControl::CacheMemory, ContainerControl::CacheRTT, ContainerControl::CacheAuto };
+	for ( int p = 0; p < 4; p++ ) {
+		for ( int i = 0; i < 3; i++ )
+			panels[i]->setCachePolicy( policies[p] );
+		screen->update();
+
+		renderer.renderOps = 0;
+		clock_t start = clock();
+		for ( int f = 0; f < FRAMES; f++ ) {
+			WidgetCollection::iterator iter = panels[1]->Children.begin();
+			Control::_cast( iter.get() )->setWidth(( float )( f % 28 ) + 2.0f );
+			for ( iter = panels[2]->Children.begin(); iter != panels[2]->Children.end(); iter++ ) {
+				Control* tile = Control::_cast( iter.get() );
+				tile->setTop( tile->getTop() + ( f % 2 ? 1.0f : -1.0f ) );
+			}
+			screen->update();
+		}
+		double time = ElapsedMS( start );
+
+		std::cout << "  " << PolicyName( policies[p] ) << ": " << time << "ms, " << renderer.renderOps << " render ops";
+		if ( policies[p] == ContainerControl::CacheAuto ) {
+			std::cout << " (chose";
+			for ( int i = 0; i < 3; i++ )
+				std::cout << " " << PolicyName( panels[i]->getActiveCachePolicy() );
+			std::cout << ")";
+		}
+		std::cout << std::endl;
+	}
+
+	for ( int i = 0; i < 3; i++ ) {
+		std::cout << "  panel " << i << ": change rate " << panels[i]->statsGetCacheChangeRate()
+				  << ", redraw fraction " << panels[i]->statsGetCacheRedrawFraction()
+				  << ", " << panels[i]->statsGetCacheOperations() << " ops" << std::endl;
+		if ( panels[i]->getActiveCachePolicy() != expected[i] )
+			throw std::exception( "Failed to choose the expected cache policy" );
+	}
+
+	delete system;
+	return 0;
+}
@@ -0,0 +1,176 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Cached panel benchmark
+// A ContainerControl holding CHILDREN static Controls and one that changes every
+// frame, like a ProgressBar ticking away on an otherwise static panel. Without
+// render to texture support the panel caches its output in memory, keeping each
+// child separately, so every frame should only draw the changing child again
+// instead of the whole panel.
+// Also times an arrange pass that moves and resizes every child, which should only
+// notify the panel once per child, not once per change. After a child has been
+// redrawn alone, invalidating the panel itself must still redraw all of it.
+
+const int CHILDREN = 500;
+const int FRAMES = 1000;
+
+unsigned int gDraws = 0;
+
+// a Control that draws its rect, and counts how often it is drawn
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		gDraws++;
+		evtArgs.brush.Primitive.drawRect( getRect() );
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+// a ContainerControl that counts the child invalidations that reach it, and its own draws
+class CountingPanel: public ContainerControl {
+public:
+	CountingPanel(): notices( 0 ), draws( 0 ) {}
+	unsigned int notices;
+	unsigned int draws;
+	// throws away the whole cache, so the next draw is a full one
+	void discardCache() {
+		dirtyCache();
+	}
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		draws++;
+		ContainerControl::onDraw( sender, evtArgs );
+	}
+	virtual void onInvalidatedChild( Object* sender, EventArgs& evtArgs ) {
+		notices++;
+		ContainerControl::onInvalidatedChild( sender, evtArgs );
+	}
+};
+
+// a NullRenderer without render textures, which records the position of what it draws
+class MemoryRenderer: public NullRenderer {
+public:
+	virtual bool supportsRenderToTexture() {
+		return false;
+	}
+	virtual void doRenderOperation( RenderOperation& renderOp ) {
+		NullRenderer::doRenderOperation( renderOp );
+		if ( record )
+			drawn.push_back( renderOp.triangleList->front().vertex[0].position );
+	}
+	bool record;
+	std::vector<FVector2> drawn;
+};
+
+int main( void ) {
+	MemoryRenderer renderer;
+	renderer.record = false;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "CachedPanel", FVector2( 800, 600 ), &viewport );
+
+	CountingPanel* panel = new CountingPanel;
+	panel->setWidth( 800.0f );
+	panel->setHeight( 600.0f );
+	screen->Children.add_back( panel, true );
+	std::vector<Control*> tiles;
+	for ( int i = 0; i < CHILDREN; i++ ) {
+		Control* tile = new TileControl;
+		tile->setLeft(( float )( i % 25 ) * 32.0f );
+		tile->setTop(( float )( i / 25 ) * 24.0f );
+		tile->setWidth( 30.0f );
+		tile->setHeight( 22.0f );
+		panel->Children.add_back( tile, true );
+		tiles.push_back( tile );
+	}
+	Control* ticker = new TileControl;
+	ticker->setTop( 580.0f );
+	ticker->setHeight( 20.0f );
+	panel->Children.add_back( ticker, true );
+	screen->update();
+
+	gDraws = 0;
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		ticker->setWidth(( float )( f % 800 ) + 2.0f ); // never its starting width
+		screen->update();
+	}
+	double time = ElapsedMS( start );
+
+	std::cout << CHILDREN << " static children and 1 changing, " << FRAMES << " frames" << std::endl
+			  << "  update: " << time << "ms, " << gDraws << " child draws" << std::endl;
+
+	if ( gDraws != FRAMES )
+		throw std::exception( "Failed to redraw only the changed child" );
+
+	// the partially redrawn cache must hold the same output, in the same order, as a full one
+	tiles[CHILDREN / 2]->setAlpha( 0.5f );
+	renderer.record = true;
+	screen->update();
+	std::vector<FVector2> partial;
+	partial.swap( renderer.drawn );
+	unsigned int panelDraws = panel->draws;
+	panel->discardCache();
+	screen->update();
+	if ( panel->draws != panelDraws + 1 )
+		throw std::exception( "Failed to redraw the panel in full" );
+	if ( partial != renderer.drawn || partial.size() != CHILDREN + 1 )
+		throw std::exception( "Failed to keep the cache in order" );
+
+	// the panel's own invalidations must still get through after a child was redrawn alone
+	tiles[1]->setAlpha( 0.5f );
+	screen->update();
+	panelDraws = panel->draws;
+	gDraws = 0;
+	panel->invalidate();
+	screen->update();
+	if ( panel->draws != panelDraws + 1 || gDraws != CHILDREN + 1 )
+		throw std::exception( "Failed to redraw the panel after a child was redrawn alone" );
+
+	// a flushed child must be redrawn even if the panel is already invalid
+	tiles[2]->setAlpha( 0.5f );
+	tiles[3]->flush();
+	gDraws = 0;
+	screen->update();
+	if ( gDraws != 2 )
+		throw std::exception( "Failed to redraw a flushed child" );
+
+	// a hidden child must come back when shown again
+	tiles[0]->setVisible( false );
+	screen->update();
+	tiles[0]->setVisible( true );
+	renderer.drawn.clear();
+	screen->update();
+	if ( renderer.drawn.size() != CHILDREN + 1 )
+		throw std::exception( "Failed to show a hidden child" );
+
+	// an arrange pass, setting the position and size of every child
+	panel->notices = 0;
+	start = clock();
+	for ( int i = 0; i < CHILDREN; i++ ) {
+		tiles[i]->setLeft( tiles[i]->getLeft() + 1.0f );
+		tiles[i]->setTop( tiles[i]->getTop() + 1.0f );
+		tiles[i]->setWidth( 29.0f );
+		tiles[i]->setHeight( 21.0f );
+	}
+	time = ElapsedMS( start );
+	std::cout << "  arrange " << CHILDREN << " children: " << time << "ms, "
+			  << panel->notices << " notices reached the panel" << std::endl;
+	if ( panel->notices != CHILDREN )
+		throw std::exception( "Failed to stop repeated invalidations at the panel" );
+	renderer.drawn.clear();
+	screen->update();
+	partial.swap( renderer.drawn );
+	renderer.drawn.clear();
+	panelDraws = panel->draws;
+	panel->discardCache();
+	screen->update();
+	if ( panel->draws != panelDraws + 1 )
+		throw std::exception( "Failed to redraw the panel in full" );
+	if ( partial != renderer.drawn || partial.size() != CHILDREN + 1 )
+		throw std::exception( "Failed to redraw the arranged children" );
+
+	delete system;
+	return 0;
+}
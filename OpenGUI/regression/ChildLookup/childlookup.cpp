@@ -0,0 +1,153 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Child lookup benchmark
+// Measures filling a container with named children, which checks every name for
+// duplicates, along with lookups by name and by path, and removal.
+
+const int CHILD_COUNT = 20000;
+const int LOOKUPS = 200000;
+const int DEPTH = 8;
+
+String ChildName( int i ) {
+	std::stringstream ss;
+	ss << "child" << i;
+	return ss.str();
+}
+
+// checks that forward and reverse iteration agree with the expected order
+void CheckOrder( WidgetCollection& collection, const std::vector<Widget*>& expected ) {
+	size_t i = 0;
+	for ( WidgetCollection::iterator iter = collection.begin(); iter != collection.end(); iter++, i++ ) {
+		if ( i >= expected.size() || iter.get() != expected[i] )
+			throw std::exception( "Failed forward iteration order" );
+	}
+	if ( i != expected.size() || collection.size() != expected.size() )
+		throw std::exception( "Failed forward iteration count" );
+	for ( WidgetCollection::reverse_iterator iter = collection.rbegin(); iter != collection.rend(); iter++ ) {
+		if ( iter.get() != expected[--i] )
+			throw std::exception( "Failed reverse iteration order" );
+	}
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+
+	std::vector<String> names;
+	for ( int i = 0; i < CHILD_COUNT; i++ )
+		names.push_back( ChildName( i ) );
+
+	ContainerControl* container = new ContainerControl;
+	std::vector<Widget*> children;
+	clock_t start = clock();
+	for ( int i = 0; i < CHILD_COUNT; i++ ) {
+		Control* child = new Control;
+		child->setName( names[i] );
+		container->Children.add_back( child, true );
+		children.push_back( child );
+	}
+	double addTime = ElapsedMS( start );
+
+	volatile int sink = 0;
+	start = clock();
+	for ( int i = 0; i < LOOKUPS; i++ ) {
+		Widget* w = container->Children.getWidget( names[( i * 7919 ) % CHILD_COUNT] );
+		sink += w ? 1 : 0;
+	}
+	double lookupTime = ElapsedMS( start );
+
+	// a chain of nested containers, each also holding all of the named children above
+	ContainerControl* chain = container;
+	ContainerControl* firstLevel = 0;
+	String path = "level";
+	for ( int d = 0; d < DEPTH; d++ ) {
+		ContainerControl* next = new ContainerControl;
+		next->setName( "level" );
+		chain->Children.add_front( next, true );
+		chain = next;
+		if ( d == 0 )
+			firstLevel = next;
+		else
+			path = path + "/level";
+	}
+	const String fullPath = path + "/../level/./" + names[0];
+	Control* leaf = new Control;
+	leaf->setName( names[0] );
+	chain->Children.add_back( leaf, true );
+	start = clock();
+	for ( int i = 0; i < LOOKUPS / 10; i++ ) {
+		if ( container->getPath( fullPath ) != leaf )
+			throw std::exception( "Failed getPath" );
+	}
+	double pathTime = ElapsedMS( start );
+
+	std::cout << "add_back " << CHILD_COUNT << " named children: " << addTime << "ms" << std::endl
+			  << "getWidget " << LOOKUPS << ": " << lookupTime << "ms" << std::endl
+			  << "getPath " << LOOKUPS / 10 << " at depth " << DEPTH << ": " << pathTime << "ms" << std::endl;
+
+	// renames must be seen by lookups and duplicate checks
+	WidgetCollection& kids = container->Children;
+	if ( kids.getWidget( names[5] ) != children[5] )
+		throw std::exception( "Failed getWidget" );
+	children[5]->setName( "renamed" );
+	if ( kids.getWidget( names[5] ) != 0 || kids.getWidget( "renamed" ) != children[5] )
+		throw std::exception( "Failed lookup after rename" );
+	bool thrown = false;
+	try {
+		children[6]->setName( "renamed" );
+	} catch ( Exception& ) {
+		thrown = true;
+	}
+	if ( !thrown || kids.getWidget( names[6] ) != children[6] )
+		throw std::exception( "Failed duplicate name on rename" );
+	thrown = false;
+	Control* dupe = new Control;
+	dupe->setName( names[7] );
+	try {
+		kids.add_front( dupe );
+	} catch ( Exception& ) {
+		thrown = true;
+	}
+	if ( !thrown || dupe->getContainer() != 0 )
+		throw std::exception( "Failed duplicate name on add" );
+	children[5]->setName( "" );
+	if ( kids.getWidget( "renamed" ) != 0 )
+		throw std::exception( "Failed lookup after clearing name" );
+	dupe->setName( "renamed" );
+	kids.add_back( dupe, true );
+	children.push_back( dupe );
+
+	// order must survive moves and removals, and removed widgets must no longer be found
+	std::vector<Widget*> expected;
+	expected.push_back( firstLevel );
+	expected.insert( expected.end(), children.begin(), children.end() );
+	CheckOrder( kids, expected );
+	kids.moveToFront( children[10] );
+	expected.erase( std::find( expected.begin(), expected.end(), children[10] ) );
+	expected.insert( expected.begin(), children[10] );
+	kids.moveToBack( expected[1] );
+	expected.push_back( expected[1] );
+	expected.erase( expected.begin() + 1 );
+	CheckOrder( kids, expected );
+	if ( kids.getWidget( names[10] ) != children[10] )
+		throw std::exception( "Failed lookup after move" );
+
+	start = clock();
+	for ( int i = CHILD_COUNT - 1; i >= CHILD_COUNT / 2; i-- ) {
+		kids.remove( children[i] );
+		delete children[i];
+	}
+	double removeTime = ElapsedMS( start );
+	if ( kids.getWidget( names[CHILD_COUNT - 1] ) != 0 || kids.getWidget( names[0] ) != children[0] )
+		throw std::exception( "Failed lookup after remove" );
+	std::cout << "remove " << CHILD_COUNT / 2 << ": " << removeTime << "ms" << std::endl;
+
+	start = clock();
+	delete container;
+	std::cout << "destroy container: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	delete system;
+	return 0;
+}
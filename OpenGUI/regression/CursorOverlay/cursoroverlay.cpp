@@ -0,0 +1,91 @@
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Cursor overlay benchmark
+// Moves the cursor over a static Screen of TILES x TILES Controls for FRAMES
+// frames. Drawn normally, every frame draws every tile again just to move the
+// cursor. With the cursor drawn as an overlay, the tiles are drawn once into a
+// render texture, and each frame only draws that texture and the cursor.
+
+const int TILES = 20;
+const int FRAMES = 10000;
+
+unsigned int gDraws = 0;
+
+// a Control that draws its rect, and counts how often it is drawn
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		gDraws++;
+		evtArgs.brush.Primitive.drawRect( getRect() );
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+// a Cursor that draws a box
+class BoxCursor: public Cursor {
+protected:
+	virtual void onDraw( Object* sender, DrawCursor_EventArgs& evtArgs ) {
+		evtArgs.brush.Primitive.drawRect( FRect( evtArgs.Position, evtArgs.Position + getSize() ) );
+	}
+};
+
+double runFrames( NullRenderer& renderer, Screen* screen, unsigned int& ops, unsigned int& draws ) {
+	screen->update();
+	renderer.renderOps = 0;
+	gDraws = 0;
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		screen->injectCursorPosition(( float )( f % 800 ), ( float )( f % 600 ) );
+		screen->update();
+	}
+	double time = ElapsedMS( start );
+	ops = renderer.renderOps;
+	draws = gDraws;
+	return time;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "CursorOverlay", FVector2( 800, 600 ), &viewport );
+	for ( int y = 0; y < TILES; y++ ) {
+		for ( int x = 0; x < TILES; x++ ) {
+			Control* tile = new TileControl;
+			tile->setLeft(( float )x * 40.0f );
+			tile->setTop(( float )y * 30.0f );
+			tile->setWidth( 40.0f );
+			tile->setHeight( 30.0f );
+			screen->Children.add_back( tile, true );
+		}
+	}
+	screen->setCursor( CursorPtr( new BoxCursor ) );
+	screen->enableCursor();
+
+	screen->setCursorOverlay( false );
+	unsigned int plainOps, plainDraws;
+	double plainTime = runFrames( renderer, screen, plainOps, plainDraws );
+
+	screen->setCursorOverlay( true );
+	unsigned int overlayOps, overlayDraws;
+	double overlayTime = runFrames( renderer, screen, overlayOps, overlayDraws );
+
+	std::cout << TILES * TILES << " static tiles, cursor moved over " << FRAMES << " frames" << std::endl
+			  << "  drawn: " << plainTime << "ms, " << plainOps << " render ops, " << plainDraws << " tile draws" << std::endl
+			  << "  overlay: " << overlayTime << "ms, " << overlayOps << " render ops, " << overlayDraws << " tile draws" << std::endl;
+
+	if ( overlayDraws != 0 || overlayOps != FRAMES * 2 ) // the scene and the cursor
+		throw std::exception( "Failed to move the cursor without drawing the Screen" );
+
+	// changes below the cursor are still drawn
+	Control* tile = Control::_cast( screen->Children.getWidgetAt( FVector2( 5.0f, 5.0f ) ) );
+	tile->setAlpha( 0.5f );
+	gDraws = 0;
+	screen->update();
+	if ( gDraws != TILES * TILES )
+		throw std::exception( "Failed to draw a change below the cursor" );
+
+	delete system;
+	return 0;
+}
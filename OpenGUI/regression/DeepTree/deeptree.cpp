@@ -0,0 +1,86 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Deep tree benchmark
+// Measures the operations that walk from a widget up through all of its parents:
+// coordinate transforms to and from the Screen, and invalidation.
+// Also checks that the casts used along the way still identify each class correctly.
+
+const int DEPTH = 32;
+const int ITERATIONS = 200000;
+const int UPDATES = 10000; // each update also redraws the tree, so fewer of these
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "DeepTree", FVector2( 800, 600 ), &viewport );
+
+	// a chain of nested containers, each offset a little from its parent
+	ContainerControl* parent = new ContainerControl;
+	parent->setLeft( 1.0f );
+	parent->setTop( 1.0f );
+	parent->setWidth( 700.0f );
+	parent->setHeight( 500.0f );
+	screen->Children.add_back( parent, true );
+	for ( int d = 1; d < DEPTH; d++ ) {
+		ContainerControl* child = new ContainerControl;
+		child->setLeft( 1.0f );
+		child->setTop( 1.0f );
+		child->setWidth( 600.0f );
+		child->setHeight( 400.0f );
+		parent->Children.add_back( child, true );
+		parent = child;
+	}
+	Control* leaf = new Control;
+	parent->Children.add_back( leaf, true );
+
+	volatile float sink = 0.0f;
+	clock_t start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		FVector2 p = leaf->pointToScreen( FVector2(( float )( i % 100 ), 5.0f ) );
+		sink += p.x;
+	}
+	double toScreenTime = ElapsedMS( start );
+
+	start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		FVector2 p = leaf->pointFromScreen( FVector2(( float )( i % 100 ), 5.0f ) );
+		sink += p.x;
+	}
+	double fromScreenTime = ElapsedMS( start );
+
+	start = clock();
+	for ( int i = 0; i < UPDATES; i++ ) {
+		leaf->flush(); // invalidates every level above the leaf
+		screen->update();
+	}
+	double invalidateTime = ElapsedMS( start );
+
+	std::cout << "Depth " << DEPTH << std::endl
+			  << "  pointToScreen " << ITERATIONS << ": " << toScreenTime << "ms" << std::endl
+			  << "  pointFromScreen " << ITERATIONS << ": " << fromScreenTime << "ms" << std::endl
+			  << "  flush + update " << UPDATES << ": " << invalidateTime << "ms" << std::endl;
+
+	// the transforms must be inverses of each other, and must match the offsets applied
+	FVector2 onScreen = leaf->pointToScreen( FVector2( 0.0f, 0.0f ) );
+	if ( onScreen != FVector2(( float ) DEPTH, ( float ) DEPTH ) )
+		throw std::exception( "Failed pointToScreen" );
+	if ( leaf->pointFromScreen( onScreen ) != FVector2( 0.0f, 0.0f ) )
+		throw std::exception( "Failed pointFromScreen" );
+
+	// kinds must follow the class hierarchy
+	Window* window = new Window;
+	if ( !window->isKindOf( Object::KIND_WIDGET | Object::KIND_CONTROL | Object::KIND_CONTAINERCONTROL )
+			|| window->isKindOf( Object::KIND_SCREEN ) )
+		throw std::exception( "Failed Window kinds" );
+	if ( Control::_cast( leaf ) != leaf || ContainerControl::_cast( leaf ) != 0 || Widget::_cast( screen ) != 0
+			|| Screen::_cast( screen ) != screen || ContainerControl::_cast( window ) != window )
+		throw std::exception( "Failed _cast" );
+	delete window;
+
+	ScreenManager::getSingleton().destroyScreen( screen );
+	delete system;
+	return 0;
+}
@@ -0,0 +1,170 @@
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Deferred submit benchmark
+// Updates SCREENS Screens of TILES x TILES Controls for FRAMES frames with
+// updateScreens(), and then again with recordScreens() on one thread while
+// another thread sends the frames to the Renderer with submitScreens(). Both
+// must send the Renderer the same render operations. Destroying a Screen
+// while frames are queued must drop its commands from those frames, and
+// texture updates made while recording must wait for their frame's submission.
+// Without OPENGUI_THREADED_UPDATE, recording and submitting alternate on one thread.
+
+const int SCREENS = 4;
+const int TILES = 20;
+const int FRAMES = 1000;
+const int OPS_PER_SCREEN = TILES * TILES * 4;
+
+// a Control that draws a few rects inside its own, so drawing costs something
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		FRect rect = getRect();
+		for ( int i = 0; i < 4; i++ ) {
+			evtArgs.brush.Primitive.drawRect( rect );
+			rect.setSize( rect.getSize() - FVector2( 4.0f, 4.0f ) );
+		}
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+// a Control that changes a texture twice each time it draws, as a font atlas does when glyphs are added
+class UploadControl: public Control {
+public:
+	UploadControl( TexturePtr texture ): mTexture( texture ) {
+		unsigned char init = 0;
+		data.createNewData( 16, 16, 1, &init );
+	}
+	TextureData data;
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		for ( int i = 0; i < 2; i++ ) {
+			data.getPixelData()[0]++;
+			TextureManager::getSingleton().updateTextureFromTextureData( mTexture, &data );
+		}
+		Control::onDraw( sender, evtArgs );
+	}
+private:
+	TexturePtr mTexture;
+};
+
+volatile bool gRecordFailed = false;
+
+// the GUI thread
+class RecordJob: public WorkerPool::Job {
+public:
+	virtual void run() {
+		try {
+			for ( int f = 0; f < FRAMES; f++ )
+				ScreenManager::getSingleton().recordScreens();
+		} catch ( ... ) {
+			gRecordFailed = true;
+			throw;
+		}
+	}
+};
+
+// the render thread, which has no vsync to wait on here, so it polls
+class SubmitJob: public WorkerPool::Job {
+public:
+	virtual void run() {
+		int submitted = 0;
+		while ( submitted < FRAMES && !gRecordFailed ) {
+			if ( ScreenManager::getSingleton().submitScreens() )
+				submitted++;
+		}
+	}
+};
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	const char* names[SCREENS] = { "DeferredSubmit1", "DeferredSubmit2", "DeferredSubmit3", "DeferredSubmit4" };
+	for ( int s = 0; s < SCREENS; s++ ) {
+		Screen* screen = ScreenManager::getSingleton().createScreen( names[s], FVector2( 800, 600 ), &viewport );
+		for ( int y = 0; y < TILES; y++ ) {
+			for ( int x = 0; x < TILES; x++ ) {
+				Control* tile = new TileControl;
+				tile->setLeft(( float )x * 40.0f );
+				tile->setTop(( float )y * 30.0f );
+				tile->setWidth( 40.0f );
+				tile->setHeight( 30.0f );
+				screen->Children.add_back( tile, true );
+			}
+		}
+	}
+	ScreenManager& manager = ScreenManager::getSingleton();
+	manager.updateScreens();
+
+	renderer.renderOps = 0;
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ )
+		manager.updateScreens();
+	double updateTime = ElapsedMS( start );
+	unsigned int updateOps = renderer.renderOps;
+
+	renderer.renderOps = 0;
+#ifdef OPENGUI_THREADED_UPDATE
+	WorkerPool pool( 1 );
+	RecordJob recordJob;
+	SubmitJob submitJob;
+	WorkerPool::JobList jobs;
+	jobs.push_back( &recordJob );
+	jobs.push_back( &submitJob );
+	start = clock();
+	pool.run( jobs );
+#else
+	start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		manager.recordScreens();
+		manager.submitScreens();
+	}
+#endif
+	double deferredTime = ElapsedMS( start );
+	unsigned int deferredOps = renderer.renderOps;
+
+	std::cout << SCREENS << " Screens of " << TILES * TILES << " tiles, updated for " << FRAMES << " frames" << std::endl
+			  << "  updateScreens: " << updateTime << "ms, " << updateOps << " render ops" << std::endl
+			  << "  record/submit: " << deferredTime << "ms, " << deferredOps << " render ops" << std::endl;
+
+	if ( updateOps != SCREENS * OPS_PER_SCREEN * FRAMES || deferredOps != updateOps )
+		throw std::exception( "Deferred submit did not draw the same as updateScreens" );
+	if ( manager.submitScreens() )
+		throw std::exception( "Submitted a frame that was never recorded" );
+
+	// two frames queued, then one of their Screens is destroyed
+	renderer.renderOps = 0;
+	manager.recordScreens();
+	manager.recordScreens();
+	manager.destroyScreen( manager.getScreen( names[0] ) );
+	if ( !manager.submitScreens() || !manager.submitScreens() || manager.submitScreens() )
+		throw std::exception( "Destroying a Screen changed the number of queued frames" );
+	if ( renderer.renderOps != ( SCREENS - 1 ) * OPS_PER_SCREEN * 2 )
+		throw std::exception( "Failed to drop the commands of a destroyed Screen" );
+
+	// texture updates made while recording are sent once, with the contents they had then
+	{
+		TextureData uploadData;
+		unsigned char init = 0;
+		uploadData.createNewData( 16, 16, 1, &init );
+		UploadControl* uploader = new UploadControl( TextureManager::getSingleton().createTextureFromTextureData( "DeferredSubmitUpload", &uploadData ) );
+		uploader->setWidth( 10.0f );
+		uploader->setHeight( 10.0f );
+		manager.getScreen( names[1] )->Children.add_back( uploader );
+		renderer.textureUpdates = 0;
+		manager.recordScreens();
+		if ( renderer.textureUpdates != 0 )
+			throw std::exception( "A texture update reached the Renderer while recording" );
+		uploader->data.getPixelData()[0] = 0;
+		manager.submitScreens();
+		if ( renderer.textureUpdates != 1 || renderer.lastUpdatePixel != 2 )
+			throw std::exception( "Failed to send the recorded texture update with its frame" );
+		delete uploader;
+	}
+
+	// a frame left queued at shutdown is discarded
+	manager.recordScreens();
+	delete system;
+	return 0;
+}
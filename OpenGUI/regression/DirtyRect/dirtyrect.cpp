@@ -0,0 +1,132 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Dirty rectangle benchmark
+// Fills a Screen with a grid of TILES x TILES small Controls and changes the
+// alpha of one of them per frame, as a blinking indicator or caret would.
+// Drawn into a Viewport that keeps its contents, each update should only
+// redraw the changed tile. The same frames are then drawn into a Viewport
+// that does not, which needs the whole Screen redrawn every time. Finally the
+// retained Viewport is timed again with a cursor shown, which must not stop
+// the Screen from redrawing only the changed tile.
+
+const int TILES = 20;
+const int FRAMES = 2000;
+
+// a Control that draws its rect, so the render operations can be counted
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		evtArgs.brush.Primitive.drawRect( getRect() );
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+// a Cursor that draws a box
+class BoxCursor: public Cursor {
+protected:
+	virtual void onDraw( Object* sender, DrawCursor_EventArgs& evtArgs ) {
+		evtArgs.brush.Primitive.drawRect( FRect( evtArgs.Position, evtArgs.Position + getSize() ) );
+	}
+};
+
+// a NullViewport that claims to keep what was drawn into it, like a render texture
+class RetainingViewport: public NullViewport {
+public:
+	RetainingViewport( const IVector2& size ): NullViewport( size ) {}
+	virtual bool retainsContents() {
+		return true;
+	}
+};
+
+double runFrames( NullRenderer& renderer, Screen* screen, std::vector<Control*>& tiles, unsigned int& ops ) {
+	screen->update(); // the first frame is always drawn entirely
+	screen->statsResetDamagedArea();
+	renderer.renderOps = 0;
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		Control* tile = tiles[( f * 7919 ) % tiles.size()];
+		tile->setAlpha( tile->getAlpha() == 1.0f ? 0.5f : 1.0f );
+		screen->update();
+	}
+	double time = ElapsedMS( start );
+	ops = renderer.renderOps;
+	return time;
+}
+
+Screen* buildScreen( const String& name, Viewport* viewport, std::vector<Control*>& tiles ) {
+	Screen* screen = ScreenManager::getSingleton().createScreen( name, FVector2( 800, 600 ), viewport );
+	screen->disableCursor();
+	for ( int y = 0; y < TILES; y++ ) {
+		for ( int x = 0; x < TILES; x++ ) {
+			Control* tile = new TileControl;
+			tile->setLeft(( float )x * 40.0f );
+			tile->setTop(( float )y * 30.0f );
+			tile->setWidth( 40.0f );
+			tile->setHeight( 30.0f );
+			screen->Children.add_back( tile, true );
+			tiles.push_back( tile );
+		}
+	}
+	return screen;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+
+	RetainingViewport retaining( IVector2( 800, 600 ) );
+	std::vector<Control*> tiles;
+	Screen* screen = buildScreen( "Partial", &retaining, tiles );
+	unsigned int partialOps;
+	double partialTime = runFrames( renderer, screen, tiles, partialOps );
+	float partialArea = screen->statsGetDamagedArea();
+
+	NullViewport plain( IVector2( 800, 600 ) );
+	std::vector<Control*> fullTiles;
+	Screen* fullScreen = buildScreen( "Full", &plain, fullTiles );
+	unsigned int fullOps;
+	double fullTime = runFrames( renderer, fullScreen, fullTiles, fullOps );
+	float fullArea = fullScreen->statsGetDamagedArea();
+
+	RetainingViewport cursorViewport( IVector2( 800, 600 ) );
+	std::vector<Control*> cursorTiles;
+	Screen* cursorScreen = buildScreen( "Cursor", &cursorViewport, cursorTiles );
+	cursorScreen->setCursor( CursorPtr( new BoxCursor ) );
+	cursorScreen->enableCursor();
+	cursorScreen->injectCursorPosition( 400.0f, 300.0f );
+	unsigned int cursorOps;
+	double cursorTime = runFrames( renderer, cursorScreen, cursorTiles, cursorOps );
+
+	std::cout << TILES * TILES << " tiles, one changed per frame, " << FRAMES << " frames" << std::endl
+			  << "  retained viewport: " << partialTime << "ms, " << partialOps << " render ops, "
+			  << partialArea * 100.0f << "% of screen per frame" << std::endl
+			  << "  plain viewport: " << fullTime << "ms, " << fullOps << " render ops, "
+			  << fullArea * 100.0f << "% of screen per frame" << std::endl
+			  << "  retained viewport with cursor: " << cursorTime << "ms, " << cursorOps << " render ops" << std::endl;
+
+	if ( partialOps != FRAMES || fullOps != FRAMES * TILES * TILES )
+		throw std::exception( "Failed to redraw only the changed tile" );
+	if ( cursorOps != FRAMES * 2 ) // the changed tile and the cursor
+		throw std::exception( "Failed to redraw only the changed tile with a cursor shown" );
+	if ( fullArea != 1.0f )
+		throw std::exception( "Failed full redraw statistic" );
+
+	// moving a tile needs both where it was and where it went redrawn
+	Control* mover = tiles[0];
+	mover->setLeft( 80.0f );
+	screen->update();
+	const FRect& area = retaining.getUpdateArea();
+	if ( area.min != FVector2( 0.0f, 0.0f ) || area.max != FVector2( 120.0f / 800.0f, 30.0f / 600.0f ) )
+		throw std::exception( "Failed to redraw a moved tile" );
+
+	// nothing changed, so nothing is redrawn
+	renderer.renderOps = 0;
+	screen->update();
+	if ( renderer.renderOps != 0 )
+		throw std::exception( "Failed to skip an unchanged frame" );
+
+	delete system;
+	return 0;
+}
@@ -0,0 +1,166 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Hit test benchmark
+// Lays out 10,000 sibling Controls and times the position queries that cursor
+// dispatch and cursor imagery selection make, both directly on the Screen and
+// within a ContainerControl. Every answer is checked against a plain scan of the
+// collection, which is how these queries used to be answered.
+// Also times cursor moves across the siblings, along with the number of widgets
+// each move is delivered to.
+
+const int GRID_SIDE = 100; // GRID_SIDE * GRID_SIDE siblings
+const float PITCH = 8.0f;
+const float WIDGET_SIZE = 6.0f; // leave gaps so that some queries miss
+const int QUERY_COUNT = 100000;
+const int MOVE_COUNT = 1000;
+const int CURSOR_MOVES = 10000;
+
+Widget* LinearScan( WidgetCollection& collection, const FVector2& pos ) {
+	for ( WidgetCollection::iterator iter = collection.begin(); iter != collection.end(); iter++ ) {
+		if ( iter->isInside( pos ) )
+			return iter.get();
+	}
+	return 0;
+}
+
+void Place( Control* ctrl, float left, float top, float size ) {
+	ctrl->setLeft( left );
+	ctrl->setTop( top );
+	ctrl->setWidth( size );
+	ctrl->setHeight( size );
+}
+
+void FillGrid( WidgetCollection& collection ) {
+	for ( int y = 0; y < GRID_SIDE; y++ ) {
+		for ( int x = 0; x < GRID_SIDE; x++ ) {
+			Control* ctrl = new Control;
+			Place( ctrl, x * PITCH, y * PITCH, WIDGET_SIZE );
+			collection.add_back( ctrl, true );
+		}
+	}
+}
+
+void MakeQueries( std::vector<FVector2>& queries ) {
+	unsigned int seed = 12345;
+	const float extent = GRID_SIDE * PITCH + PITCH; // include some points off the end of the grid
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		seed = seed * 1103515245 + 12345;
+		float x = ( float )(( seed >> 8 ) % 65536 ) / 65536.0f * extent;
+		seed = seed * 1103515245 + 12345;
+		float y = ( float )(( seed >> 8 ) % 65536 ) / 65536.0f * extent;
+		queries.push_back( FVector2( x, y ) );
+	}
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	const float extent = GRID_SIDE * PITCH;
+	NullViewport viewport( IVector2(( int )extent, ( int )extent ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "HitTest", FVector2( extent, extent ), &viewport );
+
+	std::vector<FVector2> queries;
+	MakeQueries( queries );
+	std::vector<Widget*> expected( QUERY_COUNT );
+	size_t hits = 0;
+
+	// siblings directly on the Screen
+	FillGrid( screen->Children );
+	clock_t start = clock();
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		expected[i] = LinearScan( screen->Children, queries[i] );
+		if ( expected[i] ) hits++;
+	}
+	std::cout << "Screen, linear scan (" << QUERY_COUNT << " queries, " << hits << " hits): " << ElapsedMS( start ) << "ms" << std::endl;
+
+	start = clock();
+	screen->getWidgetAt( queries[0] ); // first query pays for building the index
+	std::cout << "Screen, index build: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	start = clock();
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		if ( screen->getWidgetAt( queries[i], true ) != expected[i] )
+			throw std::exception( "Failed Screen::getWidgetAt" );
+	}
+	std::cout << "Screen, getWidgetAt: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	// moving a widget must be reflected in the next query
+	Control* moved = static_cast<Control*>( screen->getWidgetAt( FVector2( 1.0f, 1.0f ) ) );
+	Place( moved, extent - WIDGET_SIZE, extent - WIDGET_SIZE, WIDGET_SIZE );
+	if ( screen->getWidgetAt( FVector2( 1.0f, 1.0f ) ) != 0 )
+		throw std::exception( "Failed to drop moved widget" );
+	if ( screen->getWidgetAt( FVector2( extent - 1.0f, extent - 1.0f ) ) != moved )
+		throw std::exception( "Failed to find moved widget" );
+	WidgetPtrList stacked;
+	screen->getWidgetsAt( FVector2( extent - 5.0f, extent - 5.0f ), stacked ); // overlaps the last widget in the grid
+	if ( stacked.size() != 2 || stacked.front() != moved )
+		throw std::exception( "Failed Screen::getWidgetsAt ordering" );
+
+	// cursor moves, which should only reach the widgets under the cursor and the one it just left
+	screen->enableCursor();
+	screen->statsResetCursorDispatch();
+	float maxDispatch = 0.0f;
+	start = clock();
+	for ( int i = 0; i < CURSOR_MOVES; i++ ) {
+		screen->injectCursorPosition( queries[i].x, queries[i].y );
+		if ( screen->statsGetCursorDispatch() > maxDispatch )
+			maxDispatch = screen->statsGetCursorDispatch();
+	}
+	std::cout << "Screen, cursor moves (" << CURSOR_MOVES << "): " << ElapsedMS( start ) << "ms, "
+			  << "widgets reached per move (average of 5, highest seen): " << maxDispatch << std::endl;
+	screen->disableCursor();
+
+	// worst case for a lazily built index: every query follows a move
+	start = clock();
+	for ( int i = 0; i < MOVE_COUNT; i++ ) {
+		moved->setLeft(( float )( i % GRID_SIDE ) * PITCH + PITCH * 0.5f );
+		screen->getWidgetAt( queries[i] );
+	}
+	std::cout << "Screen, move + getWidgetAt (" << MOVE_COUNT << "): " << ElapsedMS( start ) << "ms" << std::endl;
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		if ( screen->getWidgetAt( queries[i] ) != LinearScan( screen->Children, queries[i] ) )
+			throw std::exception( "Failed Screen::getWidgetAt after moves" );
+	}
+
+	// remove the siblings, and put them within a single ContainerControl instead
+	while ( screen->Children.begin() != screen->Children.end() )
+		delete screen->Children.begin().get();
+	ContainerControl* container = new ContainerControl;
+	Place( container, 0.0f, 0.0f, extent );
+	screen->Children.add_back( container, true );
+	FillGrid( container->Children );
+
+	hits = 0;
+	start = clock();
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		FVector2 pos = queries[i];
+		container->_translatePointIn( pos );
+		expected[i] = LinearScan( container->Children, pos );
+		if ( expected[i] ) hits++;
+	}
+	std::cout << "ContainerControl, linear scan (" << QUERY_COUNT << " queries, " << hits << " hits): " << ElapsedMS( start ) << "ms" << std::endl;
+
+	container->getChildAt( queries[0] );
+	start = clock();
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		if ( container->getChildAt( queries[i] ) != expected[i] )
+			throw std::exception( "Failed ContainerControl::getChildAt" );
+	}
+	std::cout << "ContainerControl, getChildAt: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	start = clock();
+	for ( int i = 0; i < QUERY_COUNT; i++ ) {
+		Widget* hit = screen->getWidgetAt( queries[i], true );
+		if ( !expected[i] && container->isInside( queries[i] ) )
+			expected[i] = container;
+		if ( hit != expected[i] )
+			throw std::exception( "Failed recursive Screen::getWidgetAt" );
+	}
+	std::cout << "Screen, recursive getWidgetAt: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	ScreenManager::getSingleton().destroyScreen( screen );
+	delete system;
+	return 0;
+}
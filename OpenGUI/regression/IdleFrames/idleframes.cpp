@@ -0,0 +1,112 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Idle frame benchmark
+// Updates a static Screen of TILES x TILES Controls FRAMES times with nothing
+// changing, as a host that updates every frame does while the user is idle.
+// Drawn into a Viewport that keeps its contents, update() should skip drawing
+// entirely. The same frames are then drawn into a Viewport that does not,
+// which needs the whole Screen redrawn every time.
+
+const int TILES = 20;
+const int FRAMES = 10000;
+
+// a Control that draws its rect, so the render operations can be counted
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		evtArgs.brush.Primitive.drawRect( getRect() );
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+// a NullViewport that claims to keep what was drawn into it, like a render texture
+class RetainingViewport: public NullViewport {
+public:
+	RetainingViewport( const IVector2& size ): NullViewport( size ) {}
+	virtual bool retainsContents() {
+		return true;
+	}
+};
+
+Screen* buildScreen( const String& name, Viewport* viewport ) {
+	Screen* screen = ScreenManager::getSingleton().createScreen( name, FVector2( 800, 600 ), viewport );
+	screen->setAutoUpdating( false );
+	for ( int y = 0; y < TILES; y++ ) {
+		for ( int x = 0; x < TILES; x++ ) {
+			Control* tile = new TileControl;
+			tile->setLeft(( float )x * 40.0f );
+			tile->setTop(( float )y * 30.0f );
+			tile->setWidth( 40.0f );
+			tile->setHeight( 30.0f );
+			screen->Children.add_back( tile, true );
+		}
+	}
+	return screen;
+}
+
+double runFrames( NullRenderer& renderer, Screen* screen, unsigned int& ops ) {
+	screen->update(); // the first frame is always drawn
+	renderer.renderOps = 0;
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ )
+		screen->update();
+	double time = ElapsedMS( start );
+	ops = renderer.renderOps;
+	return time;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+
+	RetainingViewport retaining( IVector2( 800, 600 ) );
+	Screen* screen = buildScreen( "Retained", &retaining );
+	unsigned int idleOps;
+	double idleTime = runFrames( renderer, screen, idleOps );
+
+	NullViewport plain( IVector2( 800, 600 ) );
+	Screen* plainScreen = buildScreen( "Plain", &plain );
+	unsigned int plainOps;
+	double plainTime = runFrames( renderer, plainScreen, plainOps );
+
+	std::cout << TILES * TILES << " static tiles, " << FRAMES << " frames" << std::endl
+			  << "  retained viewport: " << idleTime << "ms, " << idleOps << " render ops" << std::endl
+			  << "  plain viewport: " << plainTime << "ms, " << plainOps << " render ops" << std::endl;
+
+	if ( idleOps != 0 || plainOps != FRAMES * TILES * TILES )
+		throw std::exception( "Failed to skip idle frames" );
+
+	// both Screens know they are idle, whatever their viewport
+	if ( screen->needsRedraw() || plainScreen->needsRedraw() || screen->getNextWakeup() != -1.0f )
+		throw std::exception( "Failed to report an idle Screen" );
+
+	// changes are noticed, and drawn
+	Control* tile = Control::_cast( screen->Children.getWidgetAt( FVector2( 5.0f, 5.0f ) ) );
+	tile->setAlpha( 0.5f );
+	if ( !screen->needsRedraw() || screen->getNextWakeup() != 0.0f )
+		throw std::exception( "Failed to report an invalidated Widget" );
+	renderer.renderOps = 0;
+	screen->update();
+	if ( renderer.renderOps != 1 || screen->needsRedraw() )
+		throw std::exception( "Failed to draw an invalidated Widget" );
+	screen->enableCursor();
+	screen->update();
+	screen->injectCursorPosition( 100.0f, 100.0f );
+	if ( !screen->needsRedraw() )
+		throw std::exception( "Failed to report a cursor move" );
+	screen->update();
+
+	// wake ups are reported until the time is injected after they are due
+	screen->scheduleWakeup( 60.0f );
+	screen->scheduleWakeup( 0.0f );
+	if ( screen->getNextWakeup() != 0.0f || ScreenManager::getSingleton().getNextWakeup() != -1.0f )
+		throw std::exception( "Failed to report a wake up" );
+	screen->injectTime( 0.01f );
+	if ( screen->getNextWakeup() != -1.0f )
+		throw std::exception( "Failed to clear a delivered wake up" );
+
+	delete system;
+	return 0;
+}
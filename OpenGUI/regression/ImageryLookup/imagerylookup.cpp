@@ -0,0 +1,89 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Imagery lookup benchmark
+// Builds 10,000 Imagery spread over 100 Imagesets and times the lookup paths
+// that widgets and XML loading hit when resolving imagery by name.
+
+const int SET_COUNT = 100;
+const int IMAGERY_PER_SET = 100;
+const int LOOKUP_PASSES = 20;
+
+String SetName( int set ) {
+	std::stringstream ss;
+	ss << "set" << set << ".png";
+	return ss.str();
+}
+String ImgName( int set, int img ) {
+	std::stringstream ss;
+	ss << "img_" << set << "_" << img;
+	return ss.str();
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	ImageryManager& imgMgr = ImageryManager::getSingleton();
+
+	clock_t start = clock();
+	for ( int s = 0; s < SET_COUNT; s++ ) {
+		ImagesetPtr imgset = imgMgr.createImageset( SetName( s ) );
+		for ( int i = 0; i < IMAGERY_PER_SET; i++ )
+			imgset->createImagery( ImgName( s, i ), i, i, 8, 8 );
+	}
+	std::cout << "Create " << SET_COUNT * IMAGERY_PER_SET << " Imagery: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	// build the name lists up front so we only measure the lookups
+	std::vector<String> fqnList, nameList, setList;
+	for ( int s = 0; s < SET_COUNT; s++ ) {
+		setList.push_back( SetName( s ) );
+		for ( int i = 0; i < IMAGERY_PER_SET; i++ ) {
+			fqnList.push_back( SetName( s ) + ":" + ImgName( s, i ) );
+			nameList.push_back( ImgName( s, i ) );
+		}
+	}
+
+	size_t found = 0;
+	start = clock();
+	for ( int p = 0; p < LOOKUP_PASSES; p++ )
+		for ( size_t i = 0; i < fqnList.size(); i++ )
+			if ( imgMgr.getImagery( fqnList[i] ) ) found++;
+	std::cout << "FQN lookups (" << fqnList.size() * LOOKUP_PASSES << "): " << ElapsedMS( start ) << "ms" << std::endl;
+	if ( found != fqnList.size() * LOOKUP_PASSES )
+		throw std::exception( "Failed FQN Imagery lookup" );
+
+	found = 0;
+	start = clock();
+	for ( size_t i = 0; i < nameList.size(); i++ )
+		if ( imgMgr.getImagery( nameList[i] ) ) found++;
+	std::cout << "Unqualified lookups (" << nameList.size() << "): " << ElapsedMS( start ) << "ms" << std::endl;
+	if ( found != nameList.size() )
+		throw std::exception( "Failed unqualified Imagery lookup" );
+
+	found = 0;
+	start = clock();
+	for ( int p = 0; p < LOOKUP_PASSES * IMAGERY_PER_SET; p++ )
+		for ( size_t i = 0; i < setList.size(); i++ ) {
+			ImagesetPtr imgset = imgMgr.getImageset( setList[i] );
+			if ( imgset && imgMgr.getImagesetByTexture( imgset->getTexture() ) == imgset ) found++;
+		}
+	std::cout << "Imageset lookups (" << setList.size() * LOOKUP_PASSES * IMAGERY_PER_SET << "): " << ElapsedMS( start ) << "ms" << std::endl;
+	if ( found != setList.size() * LOOKUP_PASSES * IMAGERY_PER_SET )
+		throw std::exception( "Failed Imageset lookup" );
+
+	// destruction must remove the imagery from the lookup paths
+	imgMgr.destroyImageset( setList[0] );
+	if ( imgMgr.getImagery( fqnList[0] ) || imgMgr.getImageset( setList[0] ) )
+		throw std::exception( "Failed Imageset destruction" );
+	imgMgr.getImageset( setList[1] )->destroyImagery( nameList[IMAGERY_PER_SET] );
+	if ( imgMgr.getImagery( fqnList[IMAGERY_PER_SET] ) || !imgMgr.getImagery( fqnList[IMAGERY_PER_SET + 1] ) )
+		throw std::exception( "Failed Imagery destruction" );
+
+	start = clock();
+	imgMgr.destroyAllImagesets();
+	std::cout << "Destroy all Imagesets: " << ElapsedMS( start ) << "ms" << std::endl;
+
+	delete system;
+	return 0;
+}
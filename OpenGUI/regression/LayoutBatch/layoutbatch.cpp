@@ -0,0 +1,99 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Layout batching benchmark
+// Resizes every docked child of a container once per frame and counts how many
+// layout passes the container performs. Layouts are queued and resolved once per
+// Screen::update(), so a frame of resizes should cost a single pass no matter
+// how many children were touched.
+
+const int CHILDREN = 1000;
+const int FRAMES = 20;
+
+// counts the layout passes performed by the container
+class CountingContainer: public ContainerControl {
+public:
+	CountingContainer(): passes( 0 ) {}
+	unsigned int passes;
+protected:
+	virtual void _doUpdateLayout() {
+		passes++;
+		ContainerControl::_doUpdateLayout();
+	}
+};
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "LayoutBatch", FVector2( 800, 600 ), &viewport );
+
+	CountingContainer* container = new CountingContainer;
+	container->setWidth( 800.0f );
+	container->setHeight( 600.0f );
+	screen->Children.add_back( container, true );
+
+	std::vector<Control*> children;
+	for ( int i = 0; i < CHILDREN; i++ ) {
+		Control* child = new Control;
+		child->setHeight( 1.0f );
+		child->setDocking( Control::Top );
+		container->Children.add_back( child, true );
+		children.push_back( child );
+	}
+	screen->update();
+	container->passes = 0;
+
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		float height = ( float )( f % 2 + 1 ) * 0.5f;
+		for ( int i = 0; i < CHILDREN; i++ )
+			children[i]->setHeight( height );
+		screen->update();
+	}
+	double resizeTime = ElapsedMS( start );
+
+	std::cout << CHILDREN << " docked children, " << FRAMES << " frames" << std::endl
+			  << "  resize all + update: " << resizeTime << "ms" << std::endl
+			  << "  layout passes: " << container->passes << std::endl;
+
+	// the docked children must be stacked using the final heights
+	float expect = ( float )(( FRAMES - 1 ) % 2 + 1 ) * 0.5f;
+	for ( int i = 0; i < CHILDREN; i++ ) {
+		if ( children[i]->getTop() != expect * ( float ) i || children[i]->getWidth() != 800.0f )
+			throw std::exception( "Failed docked layout" );
+	}
+
+	// suspended layouts are not performed until resumed
+	container->suspendLayout();
+	children[0]->setHeight( 3.0f );
+	screen->update();
+	if ( container->layoutValid() || children[1]->getTop() != expect )
+		throw std::exception( "Failed suspendLayout" );
+	container->resumeLayout();
+	if ( !container->layoutValid() || children[1]->getTop() != 3.0f )
+		throw std::exception( "Failed resumeLayout" );
+
+	// a container that is not on a Screen has no one to queue for, so it lays out immediately
+	ContainerControl* detached = new ContainerControl;
+	detached->setWidth( 100.0f );
+	detached->setHeight( 100.0f );
+	Control* filler = new Control;
+	detached->Children.add_back( filler, true );
+	filler->setDocking( Control::Fill );
+	if ( filler->getWidth() != 100.0f || filler->getHeight() != 100.0f )
+		throw std::exception( "Failed detached layout" );
+	delete detached;
+
+	// nor is one that was taken off its Screen while a layout was still queued there
+	children[0]->setHeight( 2.0f );
+	screen->Children.remove( container );
+	children[0]->setHeight( 4.0f );
+	if ( !container->layoutValid() || children[1]->getTop() != 4.0f )
+		throw std::exception( "Failed layout after detach" );
+	delete container;
+
+	delete system;
+	return 0;
+}
@@ -0,0 +1,172 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Measured layout benchmark
+// Builds a form of ROWS GridPanels stacked in a StackPanel, each holding CELLS
+// children, then resizes one child per frame. Desired sizes are cached, so each
+// frame should only re-measure the changed child and the panels above it.
+// For comparison, also times an application placing every child by hand after
+// each change, which is what the form required before these panels existed.
+// The Screens are inactive while timing, so update() only resolves layouts and
+// the drawing of the form does not hide the cost of laying it out.
+
+const int ROWS = 100;
+const int CELLS = 40;
+const int COLUMNS = 8;
+const int FRAMES = 1000;
+
+unsigned int gMeasures = 0;
+
+// counts how often the desired size is measured
+class CountingControl: public Control {
+protected:
+	virtual FVector2 _measure() {
+		gMeasures++;
+		return Control::_measure();
+	}
+};
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "MeasuredLayout", FVector2( 800, 600 ), &viewport );
+
+	StackPanel* form = new StackPanel;
+	form->setWidth( 800.0f );
+	form->setHeight( 600.0f );
+	form->setSpacing( 4.0f );
+	screen->Children.add_back( form, true );
+
+	std::vector<GridPanel*> grids;
+	std::vector<Control*> cells;
+	for ( int r = 0; r < ROWS; r++ ) {
+		GridPanel* grid = new GridPanel;
+		grid->setColumns( COLUMNS );
+		grid->setSpacing( 2.0f );
+		form->Children.add_back( grid, true );
+		grids.push_back( grid );
+		for ( int c = 0; c < CELLS; c++ ) {
+			Control* cell = new CountingControl;
+			cell->setWidth( 10.0f );
+			cell->setHeight( 5.0f );
+			cell->setMargin( 1.0f );
+			grid->Children.add_back( cell, true );
+			cells.push_back( cell );
+		}
+	}
+	clock_t start = clock();
+	screen->update();
+	double firstTime = ElapsedMS( start );
+	unsigned int firstMeasures = gMeasures;
+
+	gMeasures = 0;
+	screen->setActive( false );
+	start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		Control* cell = cells[( f * 7919 ) % cells.size()];
+		cell->setHeight( cell->getHeight() == 5.0f ? 6.0f : 5.0f );
+		screen->update();
+	}
+	double panelTime = ElapsedMS( start );
+	screen->setActive( true );
+	unsigned int panelMeasures = gMeasures;
+
+	// the same form built from plain containers and placed by hand after each change,
+	// as an application would have to do it without measured layouts
+	Screen* handScreen = ScreenManager::getSingleton().createScreen( "HandPlaced", FVector2( 800, 600 ), &viewport );
+	ContainerControl* handForm = new ContainerControl;
+	handForm->setWidth( 800.0f );
+	handForm->setHeight( 600.0f );
+	handScreen->Children.add_back( handForm, true );
+	std::vector<ContainerControl*> handGrids;
+	std::vector<Control*> handCells;
+	for ( int r = 0; r < ROWS; r++ ) {
+		ContainerControl* grid = new ContainerControl;
+		handForm->Children.add_back( grid, true );
+		handGrids.push_back( grid );
+		for ( int c = 0; c < CELLS; c++ ) {
+			Control* cell = new Control;
+			cell->setWidth( 10.0f );
+			cell->setHeight( 5.0f );
+			grid->Children.add_back( cell, true );
+			handCells.push_back( cell );
+		}
+	}
+	handScreen->setActive( false );
+	start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		Control* changed = handCells[( f * 7919 ) % handCells.size()];
+		changed->setHeight( changed->getHeight() == 5.0f ? 6.0f : 5.0f );
+		float top = 0.0f;
+		for ( int r = 0; r < ROWS; r++ ) {
+			float y = 0.0f;
+			float rowHeight = 0.0f;
+			for ( int c = 0; c < CELLS; c++ ) {
+				Control* cell = handCells[r * CELLS + c];
+				if ( c % COLUMNS == 0 && c > 0 ) {
+					y += rowHeight + 2.0f;
+					rowHeight = 0.0f;
+				}
+				cell->setLeft(( float )( c % COLUMNS ) * 14.0f + 1.0f );
+				cell->setTop( y + 1.0f );
+				if ( cell->getHeight() + 2.0f > rowHeight ) rowHeight = cell->getHeight() + 2.0f;
+			}
+			y += rowHeight;
+			handGrids[r]->setTop( top );
+			handGrids[r]->setWidth( 14.0f * COLUMNS - 2.0f );
+			handGrids[r]->setHeight( y );
+			top += y + 4.0f;
+		}
+		handScreen->update();
+	}
+	double manualTime = ElapsedMS( start );
+
+	std::cout << ROWS << " grids of " << CELLS << " children" << std::endl
+			  << "  first layout: " << firstTime << "ms, " << firstMeasures << " measures" << std::endl
+			  << "  resize one child + update " << FRAMES << ": " << panelTime << "ms, "
+			  << panelMeasures << " measures" << std::endl
+			  << "  resize one child, hand place all + update " << FRAMES << ": " << manualTime << "ms" << std::endl;
+
+	if ( panelMeasures != FRAMES )
+		throw std::exception( "Failed to cache desired sizes" );
+
+	// put everything back to one size and check the arrangement
+	for ( size_t i = 0; i < cells.size(); i++ )
+		cells[i]->setHeight( 5.0f );
+	screen->update();
+	float gridHeight = 5.0f * 7.0f + 2.0f * 4.0f; // 5 rows of 7 units, 4 spacings between them
+	for ( int r = 0; r < ROWS; r++ ) {
+		for ( int c = 0; c < CELLS; c++ ) {
+			Control* cell = cells[r * CELLS + c];
+			FVector2 expect(( float )( c % COLUMNS ) * 14.0f + 1.0f, ( float )( c / COLUMNS ) * 9.0f + 1.0f );
+			if ( cell->getPosition() != expect )
+				throw std::exception( "Failed grid arrangement" );
+		}
+		GridPanel* grid = grids[r];
+		if ( grid->getTop() != ( gridHeight + 4.0f ) * ( float ) r || grid->getHeight() != gridHeight
+				|| grid->getWidth() != 14.0f * COLUMNS - 2.0f )
+			throw std::exception( "Failed stack arrangement" );
+	}
+
+	// a horizontal, wrapping StackPanel flows onto new rows
+	StackPanel* flow = new StackPanel;
+	flow->setVertical( false );
+	flow->setWrap( true );
+	flow->setWidth( 25.0f );
+	screen->Children.add_back( flow, true );
+	for ( int i = 0; i < 5; i++ ) {
+		Control* item = new Control;
+		item->setWidth( 10.0f );
+		item->setHeight( 10.0f );
+		flow->Children.add_back( item, true );
+	}
+	screen->update();
+	Control* third = Control::_cast( flow->Children.getWidgetAt( FVector2( 5.0f, 15.0f ) ) );
+	if ( !third || third->getPosition() != FVector2( 0.0f, 10.0f ) || flow->getDesiredSize() != FVector2( 25.0f, 30.0f ) )
+		throw std::exception( "Failed wrapping" );
+
+	delete system;
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Multiple Screen benchmark
+// Updates SCREENS Screens of TILES x TILES Controls for FRAMES frames, first
+// on the calling thread alone, and then with THREADS update threads. Each
+// frame redraws every Screen, as none of the Viewports keep their contents.
+// Both runs must send the Renderer the same number of render operations.
+// Without OPENGUI_THREADED_UPDATE only the single thread run is made.
+
+const int SCREENS = 4;
+const int TILES = 20;
+const int FRAMES = 1000;
+const unsigned int THREADS = 4;
+
+// a Control that draws a few rects inside its own, so drawing costs something
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		FRect rect = getRect();
+		for ( int i = 0; i < 4; i++ ) {
+			evtArgs.brush.Primitive.drawRect( rect );
+			rect.setSize( rect.getSize() - FVector2( 4.0f, 4.0f ) );
+		}
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+double runFrames( NullRenderer& renderer, unsigned int& ops ) {
+	ScreenManager::getSingleton().updateScreens();
+	renderer.renderOps = 0;
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ )
+		ScreenManager::getSingleton().updateScreens();
+	double time = ElapsedMS( start );
+	ops = renderer.renderOps;
+	return time;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	const char* names[SCREENS] = { "MultiScreen1", "MultiScreen2", "MultiScreen3", "MultiScreen4" };
+	for ( int s = 0; s < SCREENS; s++ ) {
+		Screen* screen = ScreenManager::getSingleton().createScreen( names[s], FVector2( 800, 600 ), &viewport );
+		for ( int y = 0; y < TILES; y++ ) {
+			for ( int x = 0; x < TILES; x++ ) {
+				Control* tile = new TileControl;
+				tile->setLeft(( float )x * 40.0f );
+				tile->setTop(( float )y * 30.0f );
+				tile->setWidth( 40.0f );
+				tile->setHeight( 30.0f );
+				screen->Children.add_back( tile, true );
+			}
+		}
+	}
+
+	unsigned int serialOps;
+	double serialTime = runFrames( renderer, serialOps );
+
+#ifdef OPENGUI_THREADED_UPDATE
+	// a new class event list leaves every class's event table out of date before the threads draw
+	ClassEventList lateClassEvents;
+	lateClassEvents.addEvent( EventID( "MultiScreenLateEvent" ) );
+
+	ScreenManager::getSingleton().setUpdateThreads( THREADS );
+	if ( ScreenManager::getSingleton().getUpdateThreads() != THREADS )
+		throw std::exception( "Failed to start the update threads" );
+	unsigned int threadedOps;
+	double threadedTime = runFrames( renderer, threadedOps );
+	ScreenManager::getSingleton().setUpdateThreads( 1 );
+
+	std::cout << SCREENS << " Screens of " << TILES * TILES << " tiles, updated for " << FRAMES << " frames" << std::endl
+			  << "  1 thread: " << serialTime << "ms, " << serialOps << " render ops" << std::endl
+			  << "  " << THREADS << " threads: " << threadedTime << "ms, " << threadedOps << " render ops" << std::endl;
+
+	if ( serialOps != threadedOps || serialOps == 0 )
+		throw std::exception( "Threaded update did not draw the same as a single thread" );
+#else
+	ScreenManager::getSingleton().setUpdateThreads( THREADS );
+	if ( ScreenManager::getSingleton().getUpdateThreads() != 1 )
+		throw std::exception( "Started update threads without OPENGUI_THREADED_UPDATE" );
+
+	std::cout << SCREENS << " Screens of " << TILES * TILES << " tiles, updated for " << FRAMES << " frames" << std::endl
+			  << "  1 thread: " << serialTime << "ms, " << serialOps << " render ops" << std::endl
+			  << "  (built without OPENGUI_THREADED_UPDATE, threaded run skipped)" << std::endl;
+#endif
+
+	delete system;
+	return 0;
+}
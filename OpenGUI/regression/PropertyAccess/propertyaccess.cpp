@@ -0,0 +1,115 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Property access benchmark
+// Compares setting properties by name against setting them through PropertyHandles
+// resolved ahead of time, and measures CreateDefinedWidget, which applies every
+// property of the definition to each widget it builds.
+
+const int ITERATIONS = 200000;
+const int WIDGET_COUNT = 20000;
+
+Widget* ControlFactory() {
+	return new Control;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+
+	// the properties set are inherited from Control, so every lookup has to walk the accessor chain
+	const char* names[] = { "Left", "Top", "Width", "Height", "Alpha" };
+	const int nameCount = sizeof( names ) / sizeof( names[0] );
+	ContainerControl* ctrl = new ContainerControl;
+	Value val( 10.0f );
+
+	clock_t start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ )
+		ctrl->setProperty( names[i % nameCount], val );
+	double byNameTime = ElapsedMS( start );
+
+	std::vector<PropertyHandle> handles;
+	for ( int i = 0; i < nameCount; i++ )
+		handles.push_back( ctrl->resolveProperty( names[i] ) );
+	start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ )
+		ctrl->setProperty( handles[i % nameCount], val );
+	double byHandleTime = ElapsedMS( start );
+
+	std::cout << "setProperty " << ITERATIONS << std::endl
+			  << "  by name: " << byNameTime << "ms" << std::endl
+			  << "  by handle: " << byHandleTime << "ms" << std::endl;
+
+	// handles must reach the same property as the name did, and getProperty must agree
+	Value out;
+	Value width( 42.0f );
+	ctrl->setProperty( handles[2], width );
+	ctrl->getProperty( "Width", out );
+	if ( out.getValueAsFloat() != 42.0f )
+		throw std::exception( "Failed setProperty by handle" );
+	ctrl->getProperty( handles[2], out );
+	if ( out.getValueAsFloat() != 42.0f )
+		throw std::exception( "Failed getProperty by handle" );
+
+	// a handle used on an Object of another class falls back to resolving by name
+	Control* other = new Control;
+	width = Value( 17.0f );
+	other->setProperty( handles[2], width );
+	if ( other->getWidth() != 17.0f )
+		throw std::exception( "Failed setProperty by handle on another class" );
+	delete other;
+
+	// unresolved handles are refused
+	bool thrown = false;
+	try {
+		ctrl->setProperty( PropertyHandle(), val );
+	} catch ( Exception& ) {
+		thrown = true;
+	}
+	if ( !thrown )
+		throw std::exception( "Failed to reject unresolved PropertyHandle" );
+	delete ctrl;
+
+	// defined widgets
+	WidgetManager& wm = WidgetManager::getSingleton();
+	wm.RegisterWidgetFactory( "Control", "PropertyAccess", &ControlFactory );
+	ValueList props;
+	props.push_back( Value( 5.0f, "Left" ) );
+	props.push_back( Value( 6.0f, "Top" ) );
+	props.push_back( Value( 70.0f, "Width" ) );
+	props.push_back( Value( 80.0f, "Height" ) );
+	props.push_back( Value( 0.5f, "Alpha" ) );
+	props.push_back( Value( false, "Visible" ) );
+	wm.DefineWidget( "Defined", props, "Control", "PropertyAccess" );
+
+	std::vector<Widget*> widgets;
+	widgets.reserve( WIDGET_COUNT );
+	start = clock();
+	for ( int i = 0; i < WIDGET_COUNT; i++ )
+		widgets.push_back( wm.CreateDefinedWidget( "Defined" ) );
+	std::cout << "CreateDefinedWidget " << WIDGET_COUNT << ": " << ElapsedMS( start ) << "ms" << std::endl;
+
+	Control* last = static_cast<Control*>( widgets.back() );
+	if ( last->getLeft() != 5.0f || last->getTop() != 6.0f || last->getWidth() != 70.0f
+			|| last->getHeight() != 80.0f || last->getAlpha() != 0.5f || last->getVisible() )
+		throw std::exception( "Failed defined widget properties" );
+	for ( int i = 0; i < WIDGET_COUNT; i++ )
+		delete widgets[i];
+
+	// redefining must not apply handles resolved for the previous property list
+	ValueList props2;
+	props2.push_back( Value( 33.0f, "Height" ) );
+	props2.push_back( Value( 44.0f, "Width" ) );
+	wm.UndefineWidget( "Defined" );
+	wm.DefineWidget( "Defined", props2, "Control", "PropertyAccess" );
+	last = static_cast<Control*>( wm.CreateDefinedWidget( "Defined" ) );
+	if ( last->getHeight() != 33.0f || last->getWidth() != 44.0f )
+		throw std::exception( "Failed redefined widget properties" );
+	delete last;
+
+	wm.UndefineWidget( "Defined" );
+	wm.UnregisterWidgetFactory( "Control", "PropertyAccess" );
+	delete system;
+	return 0;
+}
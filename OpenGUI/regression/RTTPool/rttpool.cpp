@@ -0,0 +1,106 @@
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Render texture pool benchmark
+// A render texture cached ContainerControl that is resized every frame, like a
+// window being dragged larger, while one of its children changes. Every frame
+// throws away the cache and records it again, which should reuse the render
+// textures that were released by the previous frames rather than creating and
+// destroying a new one every time.
+// Also checks that pooled render textures are given up before any texture in
+// use is evicted to meet the memory budget.
+
+const int FRAMES = 1000;
+
+// a Control that draws its rect
+class TileControl: public Control {
+protected:
+	virtual void onDraw( Object* sender, Draw_EventArgs& evtArgs ) {
+		evtArgs.brush.Primitive.drawRect( getRect() );
+		Control::onDraw( sender, evtArgs );
+	}
+};
+
+// a NullRenderer that counts the render textures it creates and destroys, and can evict textures
+class CountingRenderer: public NullRenderer {
+public:
+	virtual bool supportsTextureEviction() {
+		return true;
+	}
+	virtual void evictTexture( Texture* texture ) {}
+	virtual void reloadTexture( Texture* texture, const String& filename ) {}
+	CountingRenderer(): created( 0 ), destroyed( 0 ) {}
+	virtual RenderTexture* createRenderTexture( const IVector2& size ) {
+		created++;
+		return NullRenderer::createRenderTexture( size );
+	}
+	virtual void destroyRenderTexture( RenderTexture* texturePtr ) {
+		destroyed++;
+		NullRenderer::destroyRenderTexture( texturePtr );
+	}
+	unsigned int created;
+	unsigned int destroyed;
+};
+
+int main( void ) {
+	CountingRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	NullViewport viewport( IVector2( 800, 600 ) );
+	Screen* screen = ScreenManager::getSingleton().createScreen( "RTTPool", FVector2( 800, 600 ), &viewport );
+	TextureManager& tm = TextureManager::getSingleton();
+
+	ContainerControl* panel = new ContainerControl;
+	panel->setWidth( 300.0f );
+	panel->setHeight( 200.0f );
+	panel->setCachePolicy( ContainerControl::CacheRTT ); // CacheAuto would stop caching something that changes this often
+	screen->Children.add_back( panel, true );
+	Control* ticker = new TileControl;
+	ticker->setHeight( 20.0f );
+	panel->Children.add_back( ticker, true );
+	screen->update();
+
+	renderer.created = 0;
+	tm.statsResetCounters();
+	clock_t start = clock();
+	for ( int f = 0; f < FRAMES; f++ ) {
+		panel->setWidth( 300.0f + ( float )( f % 400 ) ); // spans the 512 and 1024 wide buckets
+		ticker->setWidth(( float )( f % 200 ) + 2.0f );
+		screen->update();
+	}
+	double time = ElapsedMS( start );
+
+	unsigned int hits = tm.statGetRTTPoolHits();
+	unsigned int misses = tm.statGetRTTPoolMisses();
+	std::cout << "Cached panel resized over " << FRAMES << " frames" << std::endl
+			  << "  update: " << time << "ms, " << renderer.created << " render textures created" << std::endl
+			  << "  pool: " << hits << " hits, " << misses << " misses ("
+			  << ( hits + misses ? hits * 100 / ( hits + misses ) : 0 ) << "% hit rate), "
+			  << tm.statGetRTTPoolBytes() << " bytes pooled" << std::endl;
+
+	if ( renderer.created > 2 )
+		throw std::exception( "Failed to reuse pooled render textures" );
+
+	// the pooled textures must still be counted, and released when the pool is disabled
+	size_t pooled = tm.statGetRTTPoolBytes();
+	size_t resident = tm.statGetResidentBytes();
+	tm.setRenderTexturePoolSize( 0 );
+	if ( pooled == 0 || tm.statGetRTTPoolBytes() != 0 || tm.statGetResidentBytes() != resident - pooled )
+		throw std::exception( "Failed to release pooled render textures" );
+
+	// pooled render textures are idle, so they go before a texture in use is evicted
+	tm.setRenderTexturePoolSize( 16 * 1024 * 1024 );
+	RenderTexturePtr released = tm.createRenderTexture( IVector2( 512, 512 ) );
+	released = 0;
+	TexturePtr inUse = tm.createTextureFromFile( "inuse.png" );
+	tm.setMemoryBudget( tm.statGetResidentBytes() + 1024 * 1024 * 4 - 1 ); // the next file only just overflows it
+	TexturePtr loaded = tm.createTextureFromFile( "loaded.png" );
+	if ( tm.statGetEvictions() != 0 || tm.statGetRTTPoolBytes() != 0 || tm.statGetResidentBytes() > tm.getMemoryBudget() )
+		throw std::exception( "Failed to trim the pool before evicting" );
+	inUse = 0;
+	loaded = 0;
+
+	delete system;
+	if ( renderer.destroyed != renderer.created + 1 ) // plus the one created by the first update
+		throw std::exception( "Failed to destroy all render textures" );
+	return 0;
+}
@@ -0,0 +1,130 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// RefPtr microbenchmark
+// Compares copy, assignment, and destruction costs of the intrusive RefPtr against
+// the previous design, which kept the count in a separately allocated wrapper object.
+// Also measures TexturePtr dereferencing, which no longer needs a dynamic_cast.
+
+const int ITERATIONS = 2000000;
+const int POOL_SIZE = 100000;
+const int STRIDE = 7919; // walk the pool out of order, as real handles are not neatly laid out in memory
+
+// The previous RefPtr, trimmed down to the parts being measured
+template<typename T>
+class LegacyRefPtr {
+	struct RefObj {
+		RefObj( T* payload ): objPtr( payload ), refcount( 1 ) {}
+		~RefObj() {
+			delete objPtr;
+		}
+		void ref() {
+			refcount++;
+		}
+		void unref() {
+			if ( --refcount == 0 ) delete this;
+		}
+		T* objPtr;
+		unsigned int refcount;
+	};
+public:
+	LegacyRefPtr( T* ptr = 0 ): mRefObj( ptr ? new RefObj( ptr ) : 0 ) {}
+	LegacyRefPtr( const LegacyRefPtr& ptr ): mRefObj( ptr.mRefObj ) {
+		if ( mRefObj ) mRefObj->ref();
+	}
+	~LegacyRefPtr() {
+		if ( mRefObj ) mRefObj->unref();
+	}
+	LegacyRefPtr& operator=( const LegacyRefPtr& ptr ) {
+		if ( mRefObj ) mRefObj->unref();
+		mRefObj = ptr.mRefObj;
+		if ( mRefObj ) mRefObj->ref();
+		return *this;
+	}
+	T* operator->() const {
+		return mRefObj->objPtr;
+	}
+private:
+	RefObj* mRefObj;
+};
+
+class LegacyPayload {
+public:
+	int value;
+};
+class Payload: public RefCounted {
+public:
+	int value;
+};
+
+template<typename PTR, typename OBJ>
+void RunBench( const char* label ) {
+	volatile int sink = 0;
+	std::vector<PTR> pool;
+	clock_t start = clock();
+	for ( int i = 0; i < POOL_SIZE; i++ ) {
+		OBJ* obj = new OBJ;
+		obj->value = i;
+		pool.push_back( PTR( obj ) );
+	}
+	double createTime = ElapsedMS( start );
+
+	int idx = 0;
+	start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		idx = ( idx + STRIDE ) % POOL_SIZE;
+		PTR copy( pool[idx] );
+		sink += copy->value;
+	}
+	double copyTime = ElapsedMS( start );
+
+	start = clock();
+	PTR target;
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		idx = ( idx + STRIDE ) % POOL_SIZE;
+		target = pool[idx];
+		sink += target->value;
+	}
+	target = PTR();
+	double assignTime = ElapsedMS( start );
+
+	start = clock();
+	pool.clear();
+	double destroyTime = ElapsedMS( start );
+
+	std::cout << label << std::endl
+			  << "  create " << POOL_SIZE << ": " << createTime << "ms" << std::endl
+			  << "  copy " << ITERATIONS << ": " << copyTime << "ms" << std::endl
+			  << "  assign " << ITERATIONS << ": " << assignTime << "ms" << std::endl
+			  << "  destroy " << POOL_SIZE << ": " << destroyTime << "ms" << std::endl;
+}
+
+int main( void ) {
+	RunBench< LegacyRefPtr<LegacyPayload>, LegacyPayload >( "Separate count (previous RefPtr)" );
+	RunBench< RefPtr<Payload>, Payload >( "Intrusive count (RefPtr)" );
+
+	// intrusive semantics: a RefPtr made from a raw pointer joins the existing count
+	RefPtr<Payload> a = new Payload;
+	RefPtr<Payload> b = a.get();
+	if ( a.getRefCount() != 2 || b.getRefCount() != 2 )
+		throw std::exception( "Failed RefPtr from raw pointer" );
+	a = a;
+	if ( a.getRefCount() != 2 )
+		throw std::exception( "Failed RefPtr self assignment" );
+
+	// TexturePtr dereferencing
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+	TexturePtr tex = TextureManager::getSingleton().createTextureFromFile( "refptrbench.png" );
+	volatile int sink = 0;
+	clock_t start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		TexturePtr copy = tex;
+		sink += copy->getSize().x;
+	}
+	std::cout << "TexturePtr copy and dereference " << ITERATIONS << ": " << ElapsedMS( start ) << "ms" << std::endl;
+	tex = 0;
+	delete system;
+	return 0;
+}
@@ -0,0 +1,105 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Value storage benchmark
+// Measures construction, copying, and retrieval for every Value type, along with the
+// heap held by a ValueList full of each. Small types are stored within the Value itself,
+// so only String, Font, and the RefPtr types should show any heap use.
+
+const int ITERATIONS = 500000;
+const int LIST_SIZE = 10000;
+
+template<typename T>
+void RunBench( const char* label, const T& sample, T ( Value::*getter )() const ) {
+	volatile int sink = 0;
+
+	clock_t start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		Value val( sample );
+		sink += val.getType();
+	}
+	double constructTime = ElapsedMS( start );
+
+	Value source( sample, "Name" );
+	start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		Value copy( source );
+		sink += copy.getType();
+	}
+	double copyTime = ElapsedMS( start );
+
+	Value target;
+	start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		target = source;
+		sink += target.getType();
+	}
+	double assignTime = ElapsedMS( start );
+
+	start = clock();
+	for ( int i = 0; i < ITERATIONS; i++ ) {
+		T out = ( source.*getter )();
+		sink += sizeof( out );
+	}
+	double getTime = ElapsedMS( start );
+
+	size_t heapBefore = HeapBytesInUse();
+	ValueList* list = new ValueList;
+	for ( int i = 0; i < LIST_SIZE; i++ )
+		list->push_back( source );
+	size_t heapAfter = HeapBytesInUse();
+	delete list;
+
+	// copies must keep both the value and the name
+	Value check( source );
+	if ( check != source || check.getName() != source.getName() || !( ( check.*getter )() == sample ) )
+		throw std::exception( "Failed Value copy" );
+	target.clearValue();
+	target = source;
+	if ( target != source )
+		throw std::exception( "Failed Value assignment" );
+	target = target;
+	if ( target != source )
+		throw std::exception( "Failed Value self assignment" );
+
+	std::cout << label << std::endl
+			  << "  construct " << ITERATIONS << ": " << constructTime << "ms" << std::endl
+			  << "  copy " << ITERATIONS << ": " << copyTime << "ms" << std::endl
+			  << "  assign " << ITERATIONS << ": " << assignTime << "ms" << std::endl
+			  << "  get " << ITERATIONS << ": " << getTime << "ms" << std::endl
+			  << "  ValueList heap per entry: " << ( heapAfter - heapBefore ) / LIST_SIZE << " bytes" << std::endl;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+
+	RunBench<bool>( "bool", true, &Value::getValueAsBool );
+	RunBench<float>( "float", 1.5f, &Value::getValueAsFloat );
+	RunBench<int>( "int", 42, &Value::getValueAsInt );
+	RunBench<FVector2>( "FVector2", FVector2( 1.0f, 2.0f ), &Value::getValueAsFVector2 );
+	RunBench<FRect>( "FRect", FRect( 1.0f, 2.0f, 3.0f, 4.0f ), &Value::getValueAsFRect );
+	RunBench<IVector2>( "IVector2", IVector2( 1, 2 ), &Value::getValueAsIVector2 );
+	RunBench<IRect>( "IRect", IRect( 1, 2, 3, 4 ), &Value::getValueAsIRect );
+	RunBench<Color>( "Color", Color( 0.1f, 0.2f, 0.3f, 0.4f ), &Value::getValueAsColor );
+	RunBench<TextAlignment>( "TextAlignment", TextAlignment( TextAlignment::ALIGN_CENTER, TextAlignment::ALIGN_BOTTOM ), &Value::getValueAsTextAlignment );
+	RunBench<String>( "String", String( "The quick brown fox" ), &Value::getValueAsString );
+	RunBench<Font>( "Font", Font(), &Value::getValueAsFont );
+	RunBench<ImageryPtr>( "ImageryPtr", ImageryPtr(), &Value::getValueAsImageryPtr );
+	RunBench<FacePtr>( "FacePtr", FacePtr(), &Value::getValueAsFacePtr );
+	RunBench<CursorPtr>( "CursorPtr", CursorPtr(), &Value::getValueAsCursorPtr );
+
+	// a Value changing between inline and heap types must not leak or misread
+	Value val( 3.0f );
+	val.setValue( String( "heap" ) );
+	val.setValue( IRect( 5, 6, 7, 8 ) );
+	if ( val.getValueAsIRect() != IRect( 5, 6, 7, 8 ) )
+		throw std::exception( "Failed Value type change" );
+	val = Value( String( "again" ) );
+	if ( val.getValueAsString() != "again" )
+		throw std::exception( "Failed Value type change by assignment" );
+
+	delete system;
+	return 0;
+}
@@ -0,0 +1,102 @@
+
+#include "../common/NullRenderer.h"
+using namespace OpenGUI;
+
+// Widget construction benchmark
+// Measures how many widgets can be constructed (and destroyed) per second, and
+// how much heap each one holds onto, for the widget types that make up large forms.
+// Also constructs the first instance of a class from within a default event handler,
+// which must not disturb the dispatch of that event.
+
+const int WIDGET_COUNT = 20000;
+
+int gHandlerCalls = 0;
+void CountingHandler( Object* sender, EventArgs& args ) {
+	gHandlerCalls++;
+}
+
+// a class whose events are defined on first construction, as every widget class does
+ClassEventList gLateControl_ClassEventList;
+class LateControl: public Control {
+public:
+	LateControl() {
+		if ( gLateControl_ClassEventList.empty() ) {
+			gLateControl_ClassEventList.setParent( getEvents().getClassEvents() );
+			gLateControl_ClassEventList.addEvent( EventID( "Late" ) );
+		}
+		getEvents().setClassEvents( &gLateControl_ClassEventList );
+	}
+};
+
+// a Control that opens something new when resized, like a Button opening a dialog
+class OpeningControl: public Control {
+public:
+	OpeningControl(): opened( 0 ) {}
+	Control* opened;
+protected:
+	virtual void onResized( Object* sender, Resized_EventArgs& evtArgs ) {
+		if ( !opened ) {
+			opened = new LateControl;
+			setLeft( 5.0f ); // a nested event on the same sender
+		}
+		Control::onResized( sender, evtArgs );
+	}
+};
+
+template<typename WIDGET>
+void RunBench( const char* label ) {
+	std::vector<WIDGET*> widgets;
+	widgets.reserve( WIDGET_COUNT );
+
+	size_t heapBefore = HeapBytesInUse();
+	clock_t start = clock();
+	for ( int i = 0; i < WIDGET_COUNT; i++ )
+		widgets.push_back( new WIDGET );
+	double createTime = ElapsedMS( start );
+	size_t heapAfter = HeapBytesInUse();
+
+	start = clock();
+	for ( int i = 0; i < WIDGET_COUNT; i++ )
+		delete widgets[i];
+	double destroyTime = ElapsedMS( start );
+
+	std::cout << label << std::endl
+			  << "  create " << WIDGET_COUNT << ": " << createTime << "ms ("
+			  << ( int )( WIDGET_COUNT / ( createTime > 0.0 ? createTime / 1000.0 : 0.001 ) ) << " widgets/sec)" << std::endl
+			  << "  destroy " << WIDGET_COUNT << ": " << destroyTime << "ms" << std::endl
+			  << "  heap per widget: " << ( heapAfter - heapBefore ) / WIDGET_COUNT << " bytes" << std::endl;
+}
+
+int main( void ) {
+	NullRenderer renderer;
+	System* system = new System( &renderer, 0, ( LogListener* )0 );
+
+	RunBench<Control>( "Control" );
+	RunBench<ContainerControl>( "ContainerControl" );
+	RunBench<Window>( "Window" );
+
+	// events must still be bindable, and the default handlers must still run alongside bound ones
+	Control* ctrl = new Control;
+	ctrl->getEvents()["Resized"].add( new EventDelegate( &CountingHandler ) );
+	ctrl->setWidth( 10.0f );
+	if ( gHandlerCalls != 1 )
+		throw std::exception( "Failed bound event handler" );
+	ctrl->getEvents().createEvent( "Custom" );
+	ctrl->getEvents()["Custom"].add( new EventDelegate( &CountingHandler ) );
+	EventArgs args;
+	ctrl->triggerEvent( "Custom", args );
+	if ( gHandlerCalls != 2 )
+		throw std::exception( "Failed instance event" );
+	delete ctrl;
+
+	OpeningControl* opener = new OpeningControl;
+	opener->getEvents()["Resized"].add( new EventDelegate( &CountingHandler ) );
+	opener->setWidth( 10.0f );
+	if ( !opener->opened || gHandlerCalls != 3 )
+		throw std::exception( "Failed to finish an event that constructed a new class" );
+	delete opener->opened;
+	delete opener;
+
+	delete system;
+	return 0;
+}
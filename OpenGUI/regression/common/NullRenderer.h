@@ -0,0 +1,142 @@
+// OpenGUI (http://opengui.sourceforge.net)
+// This source code is released under the BSD License
+// See LICENSE.TXT for details
+
+#ifndef D41F7E2A_96B0_4c1e_8E3B_5A1C27F40B93
+#define D41F7E2A_96B0_4c1e_8E3B_5A1C27F40B93
+
+// Shared scaffolding for the regression benchmarks. Provides a Renderer and
+// Viewport that do no drawing at all, so that a full System can be brought up
+// in a console application and the library overhead measured in isolation.
+
+#include "OpenGUI.h"
+#if OPENGUI_PLATFORM != OPENGUI_PLATFORM_WIN32
+#include <malloc.h>
+#endif
+
+namespace OpenGUI {
+
+	class NullTexture: public Texture {
+	public:
+		void setName( const String& name ) {
+			_setName( name );
+		}
+		void setSize( const IVector2& size ) {
+			_setSize( size );
+		}
+	};
+
+	class NullRenderTexture: public RenderTexture {
+	public:
+		void setSize( const IVector2& size ) {
+			_setSize( size );
+		}
+	};
+
+	class NullRenderer: public Renderer {
+	public:
+		NullRenderer(): renderOps( 0 ), textureUpdates( 0 ), lastUpdatePixel( 0 ) {}
+		virtual ~NullRenderer() {}
+
+		virtual void selectViewport( Viewport* activeViewport ) {}
+		virtual void preRenderSetup() {}
+		virtual void doRenderOperation( RenderOperation& renderOp ) {
+			renderOps++;
+		}
+		virtual void postRenderCleanup() {}
+
+		virtual Texture* createTextureFromFile( const String& filename ) {
+			NullTexture* tex = new NullTexture;
+			tex->setName( filename );
+			tex->setSize( IVector2( 1024, 1024 ) );
+			return tex;
+		}
+		virtual Texture* createTextureFromTextureData( const TextureData* textureData ) {
+			NullTexture* tex = new NullTexture;
+			tex->setSize( IVector2( textureData->getWidth(), textureData->getHeight() ) );
+			return tex;
+		}
+		virtual void updateTextureFromTextureData( Texture* texture, const TextureData* textureData ) {
+			static_cast<NullTexture*>( texture )->setSize( IVector2( textureData->getWidth(), textureData->getHeight() ) );
+			textureUpdates++;
+			lastUpdatePixel = textureData->getPixelData()[0];
+		}
+		virtual void destroyTexture( Texture* texturePtr ) {
+			delete texturePtr;
+		}
+
+		virtual bool supportsRenderToTexture() {
+			return true;
+		}
+		virtual RenderTexture* createRenderTexture( const IVector2& size ) {
+			NullRenderTexture* tex = new NullRenderTexture;
+			tex->setSize( size );
+			return tex;
+		}
+		virtual void destroyRenderTexture( RenderTexture* texturePtr ) {
+			delete texturePtr;
+		}
+
+		virtual bool supportsTextureRepeat() {
+			return true;
+		}
+
+		virtual bool supportsThreadedTextures() {
+			return true;
+		}
+
+		//! number of render operations received since the last reset
+		unsigned int renderOps;
+		//! number of texture updates received since the last reset
+		unsigned int textureUpdates;
+		//! first byte of the contents given to the last texture update
+		unsigned char lastUpdatePixel;
+	};
+
+	class NullViewport: public Viewport {
+	public:
+		NullViewport( const IVector2& size ): mSize( size ) {}
+		virtual ~NullViewport() {}
+		virtual const IVector2& getSize() {
+			return mSize;
+		}
+	protected:
+		virtual void preUpdate( Screen* updatingScreen ) {}
+		virtual void postUpdate( Screen* updatingScreen ) {}
+	private:
+		IVector2 mSize;
+	};
+
+	//! Returns the elapsed time in milliseconds since \c start, where \c start was taken from clock()
+	inline double ElapsedMS( clock_t start ) {
+		return ( double )( clock() - start ) * 1000.0 / ( double ) CLOCKS_PER_SEC;
+	}
+
+	//! Returns the number of heap bytes currently allocated by all modules of the process
+	/*! Overriding operator new in the benchmark would only see its own allocations,
+	not those made from within the OpenGUI library, so this asks the heap instead. */
+	inline size_t HeapBytesInUse() {
+#if OPENGUI_PLATFORM == OPENGUI_PLATFORM_WIN32
+		size_t total = 0;
+		HANDLE heaps[64];
+		DWORD heapCount = GetProcessHeaps( 64, heaps );
+		for ( DWORD i = 0; i < heapCount && i < 64; i++ ) {
+			PROCESS_HEAP_ENTRY entry;
+			entry.lpData = NULL;
+			HeapLock( heaps[i] );
+			while ( HeapWalk( heaps[i], &entry ) ) {
+				if ( entry.wFlags & PROCESS_HEAP_ENTRY_BUSY )
+					total += entry.cbData;
+			}
+			HeapUnlock( heaps[i] );
+		}
+		return total;
+#else
+		struct mallinfo info = mallinfo();
+		return ( size_t ) info.uordblks;
+#endif
+	}
+
+} // namespace OpenGUI {
+
+#endif // D41F7E2A_96B0_4c1e_8E3B_5A1C27F40B93
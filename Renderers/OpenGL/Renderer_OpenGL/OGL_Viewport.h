@@ -49,6 +49,10 @@ namespace OpenGUI {
 		virtual OGLRTexture* getRenderTexture()const {
 			return mRenderTexture;
 		}
+		//! The render texture holds the previous frame, so Screens can redraw only what changed
+		virtual bool retainsContents() {
+			return true;
+		}
 	protected:
 		OGL_RTT_Viewport( const IVector2& size );
 		virtual ~OGL_RTT_Viewport() {}
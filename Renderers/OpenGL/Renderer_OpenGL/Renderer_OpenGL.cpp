@@ -188,7 +188,17 @@ namespace OpenGUI {
 			if ( start ) {
 				glBindFramebufferEXT( GL_FRAMEBUFFER_EXT, start->fboId );
 				glClearColor( 0.0f, 0.0f, 0.0f, 0.0f );
+				// only clear what the Screen is about to redraw, the rest is kept from last time
+				const FRect& area = mCurrentViewport->getUpdateArea();
+				const IVector2& size = mCurrentViewport->getSize();
+				int left = ( int )floorf( area.min.x * ( float )size.x );
+				int right = ( int )ceilf( area.max.x * ( float )size.x );
+				int top = ( int )floorf( area.min.y * ( float )size.y );
+				int bottom = ( int )ceilf( area.max.y * ( float )size.y );
+				glEnable( GL_SCISSOR_TEST );
+				glScissor( left, size.y - bottom, right - left, bottom - top ); // GL counts rows from the bottom
 				glClear( GL_COLOR_BUFFER_BIT );
+				glDisable( GL_SCISSOR_TEST );
 			} else
 				glBindFramebufferEXT( GL_FRAMEBUFFER_EXT, 0 );
 		}
@@ -205,20 +215,28 @@ namespace OpenGUI {
 	}
 	//###########################################################
 	Texture* Renderer_OpenGL::createTextureFromFile( const String& filename ) {
-		safeEnd();
-		selectTextureState( 0 );
 		OGLTexture* retval = 0;
-
-		//Load the image from the disk
-		TextureData* td = LoadTextureData( filename );
-		if ( !td ) return 0;
-
 		retval = new OGLTexture();
 		if ( !retval ) return 0;
 
 		retval->setName( filename );
 
-		retval->setSize( IVector2( td->getWidth(), td->getHeight() ) );
+		if ( !loadTextureFile( retval, filename ) ) {
+			delete retval;
+			return 0;
+		}
+		return retval;
+	}
+	//###########################################################
+	bool Renderer_OpenGL::loadTextureFile( OGLTexture* texture, const String& filename ) {
+		safeEnd();
+		selectTextureState( 0 );
+
+		//Load the image from the disk
+		TextureData* td = LoadTextureData( filename );
+		if ( !td ) return false;
+
+		texture->setSize( IVector2( td->getWidth(), td->getHeight() ) );
 
 		GLint internalFormat;
 		GLenum dataFormat;
@@ -238,8 +256,8 @@ namespace OpenGUI {
 		}
 
 
-		glGenTextures( 1, &( retval->textureId ) );
-		glBindTexture( GL_TEXTURE_2D, retval->textureId );
+		glGenTextures( 1, &( texture->textureId ) );
+		glBindTexture( GL_TEXTURE_2D, texture->textureId );
 		gluBuild2DMipmaps( GL_TEXTURE_2D, //2D texture
 						   internalFormat, //destination format
 						   td->getWidth(), //image width
@@ -252,6 +270,9 @@ namespace OpenGUI {
 		//set up texture filtering
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		//set up texture wrapping, tiled imagery depends on this
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT );
 		//glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,GL_NEAREST);
 		//glTexParameteri(GL_TEXTURE_2D,GL_TEXTURE_MAG_FILTER,GL_NEAREST);
 
@@ -259,7 +280,7 @@ namespace OpenGUI {
 
 		glBindTexture( GL_TEXTURE_2D, 0 );
 
-		return retval;
+		return true;
 	}
 	//###########################################################
 	Texture* Renderer_OpenGL::createTextureFromTextureData( const TextureData *textureData ) {
@@ -308,6 +329,9 @@ namespace OpenGUI {
 		//set up texture filtering
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		//set up texture wrapping, tiled imagery depends on this
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT );
 		return retval;
 	}
 	//###########################################################
@@ -360,6 +384,9 @@ namespace OpenGUI {
 		//set up texture filtering
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		//set up texture wrapping, tiled imagery depends on this
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT );
 	}
 	//###########################################################
 	void Renderer_OpenGL::destroyTexture( Texture* texturePtr ) {
@@ -376,6 +403,30 @@ namespace OpenGUI {
 		}
 	}
 	//###########################################################
+	bool Renderer_OpenGL::supportsTextureRepeat() {
+		return true;
+	}
+	//###########################################################
+	bool Renderer_OpenGL::supportsTextureEviction() {
+		return true;
+	}
+	//###########################################################
+	void Renderer_OpenGL::evictTexture( Texture* texture ) {
+		safeEnd();
+		selectTextureState( 0 );
+		OGLTexture* texptr = static_cast<OGLTexture*>( texture );
+		if ( texptr->textureId ) {
+			glDeleteTextures( 1, &( texptr->textureId ) );
+			texptr->textureId = 0;
+		}
+	}
+	//###########################################################
+	void Renderer_OpenGL::reloadTexture( Texture* texture, const String& filename ) {
+		OGLTexture* texptr = static_cast<OGLTexture*>( texture );
+		if ( !loadTextureFile( texptr, filename ) )
+			OG_THROW( Exception::ERR_FILE_NOT_READABLE, "Failed to reload texture: " + filename, __FUNCTION__ );
+	}
+	//###########################################################
 	TextureData* Renderer_OpenGL::LoadTextureData( String filename ) {
 		//we can't load anything until the system is up
 		//but we should try to play nice
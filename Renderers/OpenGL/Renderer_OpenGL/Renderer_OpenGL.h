@@ -17,6 +17,8 @@
 */
 
 namespace OpenGUI {
+	class OGLTexture; //forward declaration
+
 	class Renderer_OpenGL : public Renderer {
 	public:
 		Renderer_OpenGL( int initial_width, int initial_height );
@@ -47,6 +49,14 @@ namespace OpenGUI {
 		virtual void clearContents();
 		virtual RenderTexture* createRenderTexture( const IVector2& size );
 		virtual void destroyRenderTexture( RenderTexture* texturePtr );
+
+		// Optional texture eviction support functions
+		virtual bool supportsTextureEviction();
+		virtual void evictTexture( Texture* texture );
+		virtual void reloadTexture( Texture* texture, const String& filename );
+
+		// Optional texture repeat support functions
+		virtual bool supportsTextureRepeat();
 	private:
 		void drawTriangles( const TriangleList& triangles, float xScaleUV, float yScaleUV );
 		void drawTriangles( const TriangleList& triangles );
@@ -59,6 +69,8 @@ namespace OpenGUI {
 		//! Loads the given \c filename into a TextureData object and returns the resulting object pointer, or 0 on fail.
 		/*! \note This uses the Corona library to read the file format.	*/
 		static TextureData* LoadTextureData( String filename );
+		//! Loads the given \c filename into the given \c texture, returns \c false on fail.
+		bool loadTextureFile( OGLTexture* texture, const String& filename );
 		bool mSupportRTT;
 
 		OGL_Viewport* mCurrentViewport;